@@ -0,0 +1,101 @@
+# Validate GLSL sources at build time and embed them in a target.
+#
+#   embed_shaders(<target> <shader files>...)
+#
+# Generates embedded_shaders.h in the target's binary directory, holding each
+# source as a constexpr std::string_view in namespace shaders, named after the
+# file with dots replaced by underscores (vertexShader.vs -> vertexShader_vs).
+# Files ending in .vs are vertex shaders and .fs fragment shaders.
+#
+# Every source is compiled by glslangValidator (found on the path, or named
+# by GLSLANG_VALIDATOR) before the header is generated, so a shader which
+# does not compile fails the build. LEARNOGL_SHADER_VALIDATION chooses what
+# happens without one, since the tree does not ship a validator:
+#
+#   AUTO  validate if glslangValidator is found (the default)
+#   ON    fail to configure if it is not found
+#   OFF   never validate
+#
+# Configuring warns for each target whose shaders are embedded unvalidated.
+
+find_program(GLSLANG_VALIDATOR glslangValidator)
+set(LEARNOGL_SHADER_VALIDATION AUTO CACHE STRING
+  "Validate shaders at build time: AUTO, ON or OFF")
+set_property(CACHE LEARNOGL_SHADER_VALIDATION PROPERTY STRINGS AUTO ON OFF)
+
+if(NOT LEARNOGL_SHADER_VALIDATION MATCHES "^(AUTO|ON|OFF)$")
+  message(FATAL_ERROR "LEARNOGL_SHADER_VALIDATION must be AUTO, ON or OFF, "
+    "not ${LEARNOGL_SHADER_VALIDATION}")
+endif()
+
+set(_EMBED_SHADERS_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/EmbedShadersGenerate.cmake")
+
+function(embed_shaders target)
+  set(header "${CMAKE_CURRENT_BINARY_DIR}/embedded_shaders.h")
+  set(sources)
+  set(stamps)
+
+  file(MAKE_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/shader_validation")
+
+  set(validator "${GLSLANG_VALIDATOR}")
+  if(LEARNOGL_SHADER_VALIDATION STREQUAL "OFF")
+    set(validator "")
+    message(WARNING "LEARNOGL_SHADER_VALIDATION is OFF: the shaders of "
+      "${target} will be embedded without validation")
+  elseif(NOT GLSLANG_VALIDATOR)
+    if(LEARNOGL_SHADER_VALIDATION STREQUAL "ON")
+      message(FATAL_ERROR "glslangValidator not found: cannot validate the "
+        "shaders of ${target}. Install glslang, or set "
+        "LEARNOGL_SHADER_VALIDATION to AUTO or OFF to embed them unvalidated.")
+    endif()
+    message(WARNING "glslangValidator not found: the shaders of ${target} "
+      "will be embedded without validation. Install glslang to validate "
+      "them.")
+  endif()
+
+  # The header is generated in the source directory from paths relative to
+  # it, so that it does not depend on where the tree is.
+  set(names)
+  foreach(shader ${ARGN})
+    get_filename_component(path "${shader}" ABSOLUTE)
+    get_filename_component(name "${shader}" NAME)
+    file(RELATIVE_PATH relative "${CMAKE_CURRENT_SOURCE_DIR}" "${path}")
+    list(APPEND sources "${path}")
+    list(APPEND names "${relative}")
+
+    if(validator)
+      get_filename_component(extension "${shader}" LAST_EXT)
+      if(extension STREQUAL ".vs")
+        set(stage vert)
+      elseif(extension STREQUAL ".fs")
+        set(stage frag)
+      else()
+        message(FATAL_ERROR "Unknown shader stage for ${shader}")
+      endif()
+
+      set(stamp "${CMAKE_CURRENT_BINARY_DIR}/shader_validation/${name}.stamp")
+      add_custom_command(
+        OUTPUT "${stamp}"
+        COMMAND "${validator}" -S ${stage} "${path}"
+        COMMAND "${CMAKE_COMMAND}" -E touch "${stamp}"
+        DEPENDS "${path}"
+        COMMENT "Validating ${name}"
+        VERBATIM)
+      list(APPEND stamps "${stamp}")
+    endif()
+  endforeach()
+
+  add_custom_command(
+    OUTPUT "${header}"
+    COMMAND "${CMAKE_COMMAND}"
+      "-DOUTPUT=${header}"
+      "-DSHADERS=${names}"
+      -P "${_EMBED_SHADERS_SCRIPT}"
+    DEPENDS ${sources} ${stamps} "${_EMBED_SHADERS_SCRIPT}"
+    WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}"
+    COMMENT "Embedding shaders for ${target}"
+    VERBATIM)
+
+  target_sources(${target} PRIVATE "${header}")
+  target_include_directories(${target} PRIVATE "${CMAKE_CURRENT_BINARY_DIR}")
+endfunction()
@@ -0,0 +1,29 @@
+# Writes the header for embed_shaders(). Run with cmake -P, passing OUTPUT
+# (the header to write) and SHADERS (the list of source files, relative to
+# the working directory).
+
+set(content "// Generated by EmbedShaders.cmake from the files below. Do not edit.\n")
+string(APPEND content "#ifndef __OPENGL_TUTORIAL_EMBEDDED_SHADERS_H__\n")
+string(APPEND content "#define __OPENGL_TUTORIAL_EMBEDDED_SHADERS_H__\n\n")
+string(APPEND content "#include <string_view>\n\nnamespace shaders\n{\n")
+
+foreach(shader ${SHADERS})
+  get_filename_component(name "${shader}" NAME)
+  string(MAKE_C_IDENTIFIER "${name}" identifier)
+  file(READ "${shader}" source)
+
+  string(FIND "${source}" ")glsl\"" clash)
+  if(NOT clash EQUAL -1)
+    message(FATAL_ERROR "${shader} contains the raw string delimiter )glsl\"")
+  endif()
+
+  string(APPEND content "  // ${shader}\n")
+  string(APPEND content "  constexpr std::string_view ${identifier} = R\"glsl(${source})glsl\";\n\n")
+endforeach()
+
+string(APPEND content "}\n\n#endif // __OPENGL_TUTORIAL_EMBEDDED_SHADERS_H__\n")
+
+# Only touch the header when it changes, to avoid needless rebuilds.
+file(WRITE "${OUTPUT}.tmp" "${content}")
+execute_process(COMMAND "${CMAKE_COMMAND}" -E copy_if_different "${OUTPUT}.tmp" "${OUTPUT}")
+file(REMOVE "${OUTPUT}.tmp")
@@ -0,0 +1,23 @@
+# Let the code using gl_context.h render headlessly.
+#
+#   add_gl_context(<target>)
+#
+# Where EGL is found the target is built with LEARNOGL_HEADLESS_EGL and
+# linked with EGL, so that --headless (or LEARNOGL_BACKEND=headless) gives
+# it a surfaceless context which renders into an offscreen framebuffer, on
+# machines with no display or GPU. Elsewhere it can only open a window.
+#
+# Both are public, since the definition changes the layout of GLContext:
+# learnogl_common adds them for every exercise which links it.
+
+find_package(OpenGL QUIET COMPONENTS EGL)
+
+function(add_gl_context target)
+  if(NOT OpenGL_EGL_FOUND)
+    message(STATUS "EGL not found, so ${target} cannot render headlessly")
+    return()
+  endif()
+
+  target_compile_definitions(${target} PUBLIC LEARNOGL_HEADLESS_EGL)
+  target_link_libraries(${target} PUBLIC OpenGL::EGL)
+endfunction()
@@ -0,0 +1,196 @@
+# Add the glad loader to an executable.
+#
+#   add_glad(<target> [<glad.c>])
+#
+# glad.h and glad.c are generated at build time, into GLAD_GENERATED_DIR, by
+# the glad_generate tool from the Khronos header Common/glad/glcorearb.h, the
+# selection of it in gl_api.txt and the templates glad.h.in and glad.c.in
+# beside it, together with GLReplay's replay_calls.h from its
+# replay_calls.h.in. The generated glad.c is used unless another is
+# given. A target which links learnogl_common gets glad from the library,
+# built in the same mode.
+#
+# With LEARNOGL_PRUNE_GLAD on (the default) the target's other sources are
+# compiled into an object library, the glad_prune tool searches its object
+# files for the GL functions they reference, and the target is linked from
+# those objects and a copy of glad.c which only looks those functions up.
+# This saves hundreds of lookups at startup and the code to make them. Turn
+# it off to build with the full glad.c instead.
+#
+# With LEARNOGL_COUNT_GL_CALLS on, glad is built with GLAD_COUNT_CALLS, so
+# that every GL call goes through a wrapper which counts it for the current
+# frame (see gl_counters.h).
+#
+# With LEARNOGL_TRACE_GL_CALLS on, glad is built with GLAD_TRACE_CALLS, so
+# that a program can write its GL calls to a trace for GLReplay to run again
+# (see gl_trace.h).
+#
+# With LEARNOGL_MULTI_CONTEXT_GLAD on, glad is built with GLAD_MULTI_CONTEXT,
+# so that GL calls go through a dispatch table per context, selected for each
+# thread with gladMakeGLContextCurrent, and worker threads with contexts of
+# their own can upload and compile at the same time as the render thread.
+# The tables are always loaded in full, since calls through them leave no
+# names in the object files for pruning to find. It cannot be combined with
+# tracing.
+#
+# When pruning, the object files of learnogl_runtime are searched as well
+# for a target which links learnogl_common, and the pruned glad is linked
+# ahead of the library, so the full glad in it is left out.
+#
+# Call it last, after the target's sources, include directories and
+# libraries have all been added, since they are moved to the object library.
+#
+#   add_glad_definitions(<target> <PRIVATE|PUBLIC|INTERFACE>)
+#
+# Only adds the definitions which build glad, and the code calling it, in
+# the modes selected above.
+#
+#   add_glad_headers(<target> <PRIVATE|PUBLIC|INTERFACE>)
+#
+# Only puts the generated headers on the include path of a target, and has
+# it wait for them to be generated. add_glad() does this for its target.
+
+option(LEARNOGL_PRUNE_GLAD
+  "Only load the GL functions which each program references" ON)
+
+option(LEARNOGL_COUNT_GL_CALLS
+  "Count the GL calls, draws and uploads of each frame" OFF)
+
+option(LEARNOGL_TRACE_GL_CALLS
+  "Allow GL calls to be traced for replaying with GLReplay" OFF)
+
+option(LEARNOGL_MULTI_CONTEXT_GLAD
+  "Call GL through a dispatch table per context, selected per thread" OFF)
+
+if(LEARNOGL_MULTI_CONTEXT_GLAD AND LEARNOGL_TRACE_GL_CALLS)
+  message(FATAL_ERROR
+    "LEARNOGL_TRACE_GL_CALLS cannot be used with LEARNOGL_MULTI_CONTEXT_GLAD")
+endif()
+
+set(_GLAD_COMMON "${CMAKE_CURRENT_LIST_DIR}/..")
+
+set(GLAD_GENERATED_DIR "${CMAKE_BINARY_DIR}/glad_generated")
+set(_GLAD_GENERATED
+  "${GLAD_GENERATED_DIR}/glad/glad.h"
+  "${GLAD_GENERATED_DIR}/glad/glad.c"
+  "${GLAD_GENERATED_DIR}/replay_calls.h")
+
+if(NOT TARGET glad_generated)
+  add_executable(glad_generate "${_GLAD_COMMON}/tools/glad_generate.cpp")
+  set_target_properties(glad_generate PROPERTIES
+    CXX_STANDARD 17
+    CXX_STANDARD_REQUIRED ON)
+
+  set(templates
+    "${_GLAD_COMMON}/glad/glad.h.in"
+    "${_GLAD_COMMON}/glad/glad.c.in"
+    "${_GLAD_COMMON}/../GLReplay/replay_calls.h.in")
+
+  add_custom_command(
+    OUTPUT ${_GLAD_GENERATED}
+    COMMAND "${CMAKE_COMMAND}" -E make_directory "${GLAD_GENERATED_DIR}/glad"
+    COMMAND glad_generate "${_GLAD_COMMON}/glad/glcorearb.h"
+      "${_GLAD_COMMON}/glad/gl_api.txt"
+      "${_GLAD_COMMON}/glad/glad.h.in" "${GLAD_GENERATED_DIR}/glad/glad.h"
+      "${_GLAD_COMMON}/glad/glad.c.in" "${GLAD_GENERATED_DIR}/glad/glad.c"
+      "${_GLAD_COMMON}/../GLReplay/replay_calls.h.in"
+      "${GLAD_GENERATED_DIR}/replay_calls.h"
+    DEPENDS glad_generate "${_GLAD_COMMON}/glad/glcorearb.h"
+      "${_GLAD_COMMON}/glad/gl_api.txt" ${templates}
+    COMMENT "Generating glad"
+    VERBATIM)
+
+  add_custom_target(glad_generated DEPENDS ${_GLAD_GENERATED})
+endif()
+
+function(add_glad_definitions target scope)
+  if(LEARNOGL_COUNT_GL_CALLS)
+    target_compile_definitions(${target} ${scope} GLAD_COUNT_CALLS)
+  endif()
+
+  if(LEARNOGL_TRACE_GL_CALLS)
+    target_compile_definitions(${target} ${scope} GLAD_TRACE_CALLS)
+  endif()
+
+  if(LEARNOGL_MULTI_CONTEXT_GLAD)
+    target_compile_definitions(${target} ${scope} GLAD_MULTI_CONTEXT)
+  endif()
+endfunction()
+
+# The generated files are only known as such in the directory which
+# generates them, so they are marked in each directory which uses them.
+function(add_glad_headers target scope)
+  set_source_files_properties(${_GLAD_GENERATED} PROPERTIES GENERATED TRUE)
+  target_include_directories(${target} ${scope} "${GLAD_GENERATED_DIR}")
+  add_dependencies(${target} glad_generated)
+endfunction()
+
+function(add_glad target)
+  set(glad_source "${GLAD_GENERATED_DIR}/glad/glad.c")
+  if(ARGC GREATER 1)
+    get_filename_component(glad_source "${ARGV1}" ABSOLUTE)
+  endif()
+
+  add_glad_headers(${target} PRIVATE)
+
+  # The definitions and, unless pruning, glad itself come from the library.
+  get_target_property(libraries ${target} LINK_LIBRARIES)
+  set(common_objects)
+  set(common_target)
+  if(libraries AND learnogl_common IN_LIST libraries)
+    if(NOT LEARNOGL_PRUNE_GLAD)
+      return()
+    endif()
+    set(common_objects $<TARGET_OBJECTS:learnogl_runtime>)
+    set(common_target learnogl_runtime)
+  else()
+    add_glad_definitions(${target} PRIVATE)
+    if(NOT LEARNOGL_PRUNE_GLAD)
+      target_sources(${target} PRIVATE "${glad_source}")
+      return()
+    endif()
+  endif()
+
+  if(NOT TARGET glad_prune)
+    add_executable(glad_prune "${_GLAD_COMMON}/tools/glad_prune.cpp")
+    set_target_properties(glad_prune PROPERTIES
+      CXX_STANDARD 17
+      CXX_STANDARD_REQUIRED ON)
+  endif()
+
+  set(objects ${target}_objects)
+  get_target_property(sources ${target} SOURCES)
+  add_library(${objects} OBJECT ${sources})
+  add_dependencies(${objects} glad_generated)
+
+  foreach(property
+      INCLUDE_DIRECTORIES COMPILE_DEFINITIONS COMPILE_OPTIONS
+      CXX_STANDARD CXX_STANDARD_REQUIRED)
+    get_target_property(value ${target} ${property})
+    if(value)
+      set_property(TARGET ${objects} PROPERTY ${property} "${value}")
+    endif()
+  endforeach()
+
+  # For the include directories and definitions the libraries bring.
+  if(libraries)
+    target_link_libraries(${objects} PRIVATE ${libraries})
+  endif()
+
+  set(pruned "${CMAKE_CURRENT_BINARY_DIR}/${target}_glad.c")
+  add_custom_command(
+    OUTPUT "${pruned}"
+    COMMAND glad_prune "${pruned}" "${glad_source}"
+      $<TARGET_OBJECTS:${objects}> ${common_objects}
+    DEPENDS glad_prune "${glad_source}" ${objects} $<TARGET_OBJECTS:${objects}>
+      ${common_target} ${common_objects}
+    COMMAND_EXPAND_LISTS
+    COMMENT "Pruning glad for ${target}"
+    VERBATIM)
+
+  set_property(TARGET ${target} PROPERTY SOURCES
+    "$<TARGET_OBJECTS:${objects}>" "${pruned}")
+
+  # Only C is compiled for the target itself now.
+  set_property(TARGET ${target} PROPERTY LINKER_LANGUAGE CXX)
+endfunction()
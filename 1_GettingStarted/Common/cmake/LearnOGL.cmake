@@ -0,0 +1,39 @@
+# Settings shared by every exercise, and the learnogl_common library they
+# link, whether they are built together from the top-level CMakeLists.txt or
+# one at a time from their own directories.
+#
+# With LEARNOGL_UNITY_BUILD on, the sources of each target are compiled in
+# batches, as one translation unit each, which makes full rebuilds faster.
+#
+# With LEARNOGL_LTO on, everything is built with link time optimization, so
+# that the compiler can inline across learnogl_common and the exercises. It
+# is left off, with a warning, where the compiler cannot do it.
+
+option(LEARNOGL_UNITY_BUILD "Compile the sources of each target in batches" OFF)
+
+option(LEARNOGL_LTO "Build with link time optimization" OFF)
+
+set(CMAKE_CXX_STANDARD 17)
+set(CMAKE_CXX_STANDARD_REQUIRED ON)
+
+if(LEARNOGL_UNITY_BUILD)
+  set(CMAKE_UNITY_BUILD ON)
+endif()
+
+if(LEARNOGL_LTO)
+  include(CheckIPOSupported)
+  check_ipo_supported(RESULT supported OUTPUT output LANGUAGES C CXX)
+  if(supported)
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)
+  else()
+    message(WARNING "Link time optimization is not supported: ${output}")
+  endif()
+endif()
+
+include("${CMAKE_CURRENT_LIST_DIR}/Glad.cmake")
+include("${CMAKE_CURRENT_LIST_DIR}/GLContext.cmake")
+
+if(NOT TARGET learnogl_common)
+  add_subdirectory("${CMAKE_CURRENT_LIST_DIR}/.."
+    "${CMAKE_BINARY_DIR}/learnogl_common")
+endif()
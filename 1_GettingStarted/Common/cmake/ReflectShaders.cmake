@@ -0,0 +1,49 @@
+# Generate C++ descriptions of GLSL sources at build time.
+#
+#   reflect_shaders(<target> <shader files>...)
+#
+# Builds the glsl_reflect tool and runs it over the sources to generate
+# reflected_shaders.h in the target's binary directory. For each file it
+# holds, in namespace reflected::<file name with dots replaced by underscores>,
+# the uniforms, the vertex inputs (of .vs files) and the offsets of std140
+# uniform block members as constexpr data, and a Binder struct with a typed
+# Uniform<T> handle for each uniform. A uniform which is renamed or changes
+# type in the GLSL then fails to compile instead of failing at run time.
+
+set(_REFLECT_SHADERS_COMMON "${CMAKE_CURRENT_LIST_DIR}/..")
+
+function(reflect_shaders target)
+  set(header "${CMAKE_CURRENT_BINARY_DIR}/reflected_shaders.h")
+  set(sources)
+
+  if(NOT TARGET glsl_reflect)
+    add_executable(glsl_reflect
+      "${_REFLECT_SHADERS_COMMON}/tools/glsl_reflect.cpp"
+      "${_REFLECT_SHADERS_COMMON}/std140.cpp")
+    target_include_directories(glsl_reflect PRIVATE "${_REFLECT_SHADERS_COMMON}")
+    set_target_properties(glsl_reflect PROPERTIES
+      CXX_STANDARD 17
+      CXX_STANDARD_REQUIRED ON)
+  endif()
+
+  # The tool is given paths relative to the source directory, and run from
+  # there, so that the header does not depend on where the tree is.
+  set(names)
+  foreach(shader ${ARGN})
+    get_filename_component(path "${shader}" ABSOLUTE)
+    file(RELATIVE_PATH name "${CMAKE_CURRENT_SOURCE_DIR}" "${path}")
+    list(APPEND sources "${path}")
+    list(APPEND names "${name}")
+  endforeach()
+
+  add_custom_command(
+    OUTPUT "${header}"
+    COMMAND glsl_reflect "${header}" ${names}
+    DEPENDS glsl_reflect ${sources}
+    WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}"
+    COMMENT "Reflecting shaders for ${target}"
+    VERBATIM)
+
+  target_sources(${target} PRIVATE "${header}")
+  target_include_directories(${target} PRIVATE "${CMAKE_CURRENT_BINARY_DIR}")
+endfunction()
@@ -0,0 +1,334 @@
+#include "gl_context.h"
+
+GLBackend GLContext::requested(int argc, char** argv)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (std::strcmp(argv[i], "--headless") == 0) return GLBackend::Headless;
+  }
+
+  const char* value = std::getenv("LEARNOGL_BACKEND");
+  return value != nullptr && std::strcmp(value, "headless") == 0
+    ? GLBackend::Headless : GLBackend::Window;
+}
+
+GLContext::~GLContext()
+{
+  if (window != nullptr)
+  {
+    glfwDestroyWindow(window);
+    glfwTerminate();
+  }
+
+#ifdef LEARNOGL_HEADLESS_EGL
+  if (context != EGL_NO_CONTEXT)
+  {
+    // glad may never have been loaded, so these are looked up as they were
+    // in createHeadless().
+    if (framebuffer != 0)
+    {
+      auto deleteFramebuffers = reinterpret_cast<PFNGLDELETEFRAMEBUFFERSPROC>(
+        eglGetProcAddress("glDeleteFramebuffers"));
+      auto deleteRenderbuffers =
+        reinterpret_cast<PFNGLDELETERENDERBUFFERSPROC>(
+          eglGetProcAddress("glDeleteRenderbuffers"));
+      if (deleteFramebuffers != nullptr) deleteFramebuffers(1, &framebuffer);
+      if (deleteRenderbuffers != nullptr)
+      {
+        deleteRenderbuffers(2, renderbuffers);
+      }
+    }
+
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(display, context);
+    eglTerminate(display);
+  }
+#endif
+}
+
+bool GLContext::create(
+  GLBackend backend, int width, int height, const char* title, bool debug)
+{
+  kind = backend;
+  frameWidth = width;
+  frameHeight = height;
+
+  // The new context may come from another driver, and has none of the old
+  // one's shader objects, and no program bound.
+  ProgramCache::instance().contextChanged();
+  ShaderObjectCache::instance().contextChanged();
+  Shader::setUniformTarget(0);
+
+  return backend == GLBackend::Headless
+    ? createHeadless(width, height, debug)
+    : createWindow(width, height, title, debug);
+}
+
+GLADloadproc GLContext::loader() const
+{
+#ifdef LEARNOGL_HEADLESS_EGL
+  if (kind == GLBackend::Headless)
+  {
+    return reinterpret_cast<GLADloadproc>(eglGetProcAddress);
+  }
+#endif
+
+  return reinterpret_cast<GLADloadproc>(glfwGetProcAddress);
+}
+
+bool GLContext::loadGL() const
+{
+  return kind == GLBackend::Headless
+    ? gladLoadGLLoaderLazy(loader()) != 0
+    : gladLoadGLLoader(loader()) != 0;
+}
+
+bool GLContext::shouldClose() const
+{
+  return window != nullptr ? glfwWindowShouldClose(window) != 0 : closing;
+}
+
+void GLContext::close()
+{
+  if (window != nullptr)
+  {
+    glfwSetWindowShouldClose(window, true);
+  }
+
+  closing = true;
+}
+
+bool GLContext::keyPressed(int key) const
+{
+  return window != nullptr && glfwGetKey(window, key) == GLFW_PRESS;
+}
+
+void GLContext::onResize(void (*callback)(int width, int height))
+{
+  resizeCallback = callback;
+}
+
+void GLContext::swapBuffers()
+{
+  if (window != nullptr)
+  {
+    glfwSwapBuffers(window);
+  }
+  else
+  {
+    glFinish();
+    frames++;
+    if (frames >= frameLimit)
+    {
+      closing = true;
+      if (!output.empty() && !saveFrame(output))
+      {
+        std::cout << "Failed to write " << output << std::endl;
+      }
+    }
+  }
+
+  endFrameCounters();
+}
+
+void GLContext::pollEvents()
+{
+  if (window != nullptr)
+  {
+    glfwPollEvents();
+  }
+}
+
+double GLContext::time() const
+{
+  return window != nullptr ? glfwGetTime() : frames / 60.0;
+}
+
+bool GLContext::createWindow(
+  int width, int height, const char* title, bool debug)
+{
+  glfwInit();
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  if (debug)
+  {
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+  }
+
+  window = glfwCreateWindow(width, height, title, NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window (run with --headless to "
+                 "render without a display)" << std::endl;
+    glfwTerminate();
+    return false;
+  }
+
+  glfwMakeContextCurrent(window);
+  glfwSetWindowUserPointer(window, this);
+  glfwSetFramebufferSizeCallback(window, &GLContext::framebufferSize);
+  return true;
+}
+
+bool GLContext::createHeadless(int width, int height, bool debug)
+{
+#ifdef LEARNOGL_HEADLESS_EGL
+  const char* frameCount = std::getenv("LEARNOGL_HEADLESS_FRAMES");
+  if (frameCount != nullptr && std::atoi(frameCount) > 0)
+  {
+    frameLimit = static_cast<std::uint64_t>(std::atoi(frameCount));
+  }
+
+  const char* path = std::getenv("LEARNOGL_HEADLESS_OUTPUT");
+  output = path != nullptr ? path : "";
+
+  // Mesa's surfaceless platform needs no display server at all.
+  auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+    eglGetProcAddress("eglGetPlatformDisplayEXT"));
+  display = getPlatformDisplay != nullptr
+    ? getPlatformDisplay(
+        EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr)
+    : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+  if (!eglInitialize(display, nullptr, nullptr))
+  {
+    std::cout << "Failed to initialise EGL" << std::endl;
+    display = EGL_NO_DISPLAY;
+    return false;
+  }
+
+  // Until the context is ready, returning undoes what was done so far, so
+  // that a failure does not leave the display initialised.
+  struct Undo
+  {
+    GLContext& owner;
+    bool keep = false;
+
+    ~Undo()
+    {
+      if (keep) return;
+
+      if (owner.context != EGL_NO_CONTEXT)
+      {
+        eglMakeCurrent(
+          owner.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(owner.display, owner.context);
+        owner.context = EGL_NO_CONTEXT;
+      }
+
+      eglTerminate(owner.display);
+      owner.display = EGL_NO_DISPLAY;
+    }
+  } undo{ *this };
+
+  if (!eglBindAPI(EGL_OPENGL_API))
+  {
+    std::cout << "Failed to initialise EGL" << std::endl;
+    return false;
+  }
+
+  const EGLint attributes[] =
+  {
+    EGL_CONTEXT_MAJOR_VERSION, 3,
+    EGL_CONTEXT_MINOR_VERSION, 3,
+    EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+    EGL_CONTEXT_OPENGL_DEBUG, debug ? EGL_TRUE : EGL_FALSE,
+    EGL_NONE
+  };
+
+  context = eglCreateContext(
+    display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+  if (context == EGL_NO_CONTEXT ||
+      !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+  {
+    std::cout << "Failed to create a headless GL context" << std::endl;
+    return false;
+  }
+
+  // The framebuffer which stands in for the window's. glad is not loaded
+  // yet, so the few functions this takes are looked up here.
+  auto genRenderbuffers = reinterpret_cast<PFNGLGENRENDERBUFFERSPROC>(
+    eglGetProcAddress("glGenRenderbuffers"));
+  auto bindRenderbuffer = reinterpret_cast<PFNGLBINDRENDERBUFFERPROC>(
+    eglGetProcAddress("glBindRenderbuffer"));
+  auto renderbufferStorage = reinterpret_cast<PFNGLRENDERBUFFERSTORAGEPROC>(
+    eglGetProcAddress("glRenderbufferStorage"));
+  auto genFramebuffers = reinterpret_cast<PFNGLGENFRAMEBUFFERSPROC>(
+    eglGetProcAddress("glGenFramebuffers"));
+  auto bindFramebuffer = reinterpret_cast<PFNGLBINDFRAMEBUFFERPROC>(
+    eglGetProcAddress("glBindFramebuffer"));
+  auto framebufferRenderbuffer =
+    reinterpret_cast<PFNGLFRAMEBUFFERRENDERBUFFERPROC>(
+      eglGetProcAddress("glFramebufferRenderbuffer"));
+
+  // A driver may not have them, for example below GL 3.0.
+  if (genRenderbuffers == nullptr || bindRenderbuffer == nullptr ||
+      renderbufferStorage == nullptr || genFramebuffers == nullptr ||
+      bindFramebuffer == nullptr || framebufferRenderbuffer == nullptr)
+  {
+    std::cout << "Failed to create a headless GL context" << std::endl;
+    return false;
+  }
+
+  genRenderbuffers(2, renderbuffers);
+  bindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+  renderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+  bindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+  renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+  bindRenderbuffer(GL_RENDERBUFFER, 0);
+
+  genFramebuffers(1, &framebuffer);
+  bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+  framebufferRenderbuffer(
+    GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+  framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+    GL_RENDERBUFFER, renderbuffers[1]);
+
+  undo.keep = true;
+  return true;
+#else
+  (void)width;
+  (void)height;
+  (void)debug;
+  std::cout << "Built without EGL, so cannot render headlessly" << std::endl;
+  return false;
+#endif
+}
+
+bool GLContext::saveFrame(const std::string& path) const
+{
+  std::vector<unsigned char> pixels(frameWidth * frameHeight * 4);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+  glReadBuffer(GL_COLOR_ATTACHMENT0);
+  glReadPixels(0, 0, frameWidth, frameHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+    pixels.data());
+
+  std::ofstream file(path, std::ios::binary);
+  file << "P6\n" << frameWidth << " " << frameHeight << "\n255\n";
+  for (int y = frameHeight - 1; y >= 0; y--)
+  {
+    for (int x = 0; x < frameWidth; x++)
+    {
+      file.write(reinterpret_cast<const char*>(
+        &pixels[(y * frameWidth + x) * 4]), 3);
+    }
+  }
+
+  return static_cast<bool>(file);
+}
+
+void GLContext::framebufferSize(GLFWwindow* window, int width, int height)
+{
+  GLContext* context =
+    static_cast<GLContext*>(glfwGetWindowUserPointer(window));
+  context->frameWidth = width;
+  context->frameHeight = height;
+  if (context->resizeCallback != nullptr)
+  {
+    context->resizeCallback(width, height);
+  }
+}
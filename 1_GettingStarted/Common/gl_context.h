@@ -0,0 +1,119 @@
+#ifndef __OPENGL_TUTORIAL_GL_CONTEXT_H__
+#define __OPENGL_TUTORIAL_GL_CONTEXT_H__
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+#include "gl_counters.h"
+#include "program_cache.h"
+#include "shader.h"
+#include "shader_object_cache.h"
+#ifdef LEARNOGL_HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Where the context a program renders with comes from.
+enum class GLBackend
+{
+  Window,   // a GLFW window
+  Headless  // a surfaceless EGL context, rendering into a framebuffer object
+};
+
+// The GL 3.3 core context a program renders with, and what stands in for its
+// window. The headless backend needs no display, nor a GPU, since Mesa runs
+// it on the CPU with llvmpipe: frames are drawn into an offscreen framebuffer
+// which is bound in place of the default one, and it closes itself after a
+// set number of frames, so that programs can be run in batches and
+// benchmarked on machines without either. It is only built in where CMake
+// finds EGL (see GLContext.cmake).
+class GLContext
+{
+public:
+  // The backend asked for: --headless on the command line, or
+  // LEARNOGL_BACKEND=headless in the environment. A window otherwise.
+  static GLBackend requested(int argc, char** argv);
+
+  GLContext() = default;
+
+  // Destroy the context, and the window if there is one.
+  ~GLContext();
+
+  GLContext(const GLContext&) = delete;
+  GLContext& operator=(const GLContext&) = delete;
+
+  // Create the context and make it current. Prints why and returns false if
+  // it cannot be created. A debug context sends KHR_debug messages.
+  bool create(
+    GLBackend backend, int width, int height, const char* title,
+    bool debug = false);
+
+  // The function to load glad with.
+  GLADloadproc loader() const;
+
+  // Load glad for the context, which must be current. Headless runs are
+  // short and call few of glad's functions, so each is only looked up when
+  // it is first called (gladLoadGLLoaderLazy); with a window, all of them
+  // are looked up now. Returns false on failure.
+  bool loadGL() const;
+
+  GLBackend backend() const { return kind; }
+
+  // Whether the window was asked to close, or the headless frames have all
+  // been drawn. LEARNOGL_HEADLESS_FRAMES sets how many (60 by default).
+  bool shouldClose() const;
+  void close();
+
+  // Whether a key (GLFW_KEY_...) is held down. Never, without a window.
+  bool keyPressed(int key) const;
+
+  // Have the new size passed to the callback when the framebuffer is resized.
+  void onResize(void (*callback)(int width, int height));
+
+  // Present the frame drawn. Headless, this waits for it to be rendered, as
+  // presenting it would, and saves the last frame to the PPM file
+  // LEARNOGL_HEADLESS_OUTPUT names, if it names one. Either way it ends the
+  // frame's GL call counts (see gl_counters.h).
+  void swapBuffers();
+
+  void pollEvents();
+
+  // Seconds since the context was created. Headless, it goes up by 1/60 a
+  // frame, so that each run draws the same frames.
+  double time() const;
+
+private:
+  bool createWindow(int width, int height, const char* title, bool debug);
+  bool createHeadless(int width, int height, bool debug);
+
+  // Save the colour of the offscreen framebuffer as a binary PPM.
+  bool saveFrame(const std::string& path) const;
+
+  static void framebufferSize(GLFWwindow* window, int width, int height);
+
+  GLBackend kind = GLBackend::Window;
+  int frameWidth = 0;
+  int frameHeight = 0;
+
+  GLFWwindow* window = nullptr;
+  void (*resizeCallback)(int width, int height) = nullptr;
+
+#ifdef LEARNOGL_HEADLESS_EGL
+  EGLDisplay display = EGL_NO_DISPLAY;
+  EGLContext context = EGL_NO_CONTEXT;
+#endif
+  GLuint framebuffer = 0;
+  GLuint renderbuffers[2] = {0, 0};
+  std::uint64_t frames = 0;
+  std::uint64_t frameLimit = 60;
+  bool closing = false;
+  std::string output;
+};
+
+#endif // __OPENGL_TUTORIAL_GL_CONTEXT_H__
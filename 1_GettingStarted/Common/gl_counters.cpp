@@ -0,0 +1,40 @@
+#include "gl_counters.h"
+
+void endFrameCounters()
+{
+#ifdef GLAD_COUNT_CALLS
+  gladGLEndFrame();
+#endif
+}
+
+void printFrameCounters(std::ostream& out)
+{
+#ifdef GLAD_COUNT_CALLS
+  const gladGLCounters& counters = *gladGLFrameCounters();
+  out << "GL calls in the last frame: " << counters.calls
+      << ", state changes: " << counters.state_changes
+      << ", draws: " << counters.draws
+      << ", primitives: " << counters.primitives
+      << ", bytes uploaded: " << counters.bytes_uploaded << std::endl;
+
+  std::vector<std::pair<GLuint64, int>> called;
+  for (int i = 0; i < GLAD_GL_FUNCTION_COUNT; i++)
+  {
+    if (counters.function_calls[i] > 0)
+    {
+      called.emplace_back(counters.function_calls[i], i);
+    }
+  }
+
+  std::sort(called.begin(), called.end(),
+    [](const auto& a, const auto& b) { return a.first > b.first; });
+
+  for (const auto& function : called)
+  {
+    out << "  " << gladGLFunctionName(function.second) << ": "
+        << function.first << std::endl;
+  }
+#else
+  (void)out;
+#endif
+}
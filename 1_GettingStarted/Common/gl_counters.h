@@ -0,0 +1,23 @@
+#ifndef __OPENGL_TUTORIAL_GL_COUNTERS_H__
+#define __OPENGL_TUTORIAL_GL_COUNTERS_H__
+
+#include "glad/glad.h"
+#include <algorithm>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+// Per-frame counts of GL calls, state changes, draws, primitives and bytes
+// uploaded, which glad keeps when it is built with GLAD_COUNT_CALLS (the
+// LEARNOGL_COUNT_GL_CALLS option in CMake). Without it these do nothing and
+// GL calls are not wrapped at all.
+
+// Make the counts so far those of the last frame, and count the next one from
+// zero. GLContext::swapBuffers calls it.
+void endFrameCounters();
+
+// Print the counts of the last frame, with the calls of each function which
+// was called, most called first.
+void printFrameCounters(std::ostream& out);
+
+#endif // __OPENGL_TUTORIAL_GL_COUNTERS_H__
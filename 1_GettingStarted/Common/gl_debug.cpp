@@ -0,0 +1,239 @@
+#include "gl_debug.h"
+
+GLDebugOutput::GLDebugOutput()
+{
+  for (std::size_t i = 0; i < capacity; i++)
+  {
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+GLDebugOutput& GLDebugOutput::instance()
+{
+  static GLDebugOutput output;
+  return output;
+}
+
+bool GLDebugOutput::requested()
+{
+  const char* value = std::getenv("LEARNOGL_GL_DEBUG");
+  return value != nullptr && *value != '\0' && std::strcmp(value, "0") != 0;
+}
+
+bool GLDebugOutput::install(bool synchronous)
+{
+  if (!GLAD_GL_KHR_debug) return false;
+
+  glEnable(GL_DEBUG_OUTPUT);
+  if (synchronous)
+  {
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+  }
+
+  glDebugMessageCallback(&GLDebugOutput::callback, this);
+  glDebugMessageControl(
+    GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+  return true;
+}
+
+void GLDebugOutput::uninstall()
+{
+  if (!GLAD_GL_KHR_debug) return;
+
+  glDebugMessageCallback(NULL, NULL);
+  glDisable(GL_DEBUG_OUTPUT);
+}
+
+void GLDebugOutput::endFrame()
+{
+  for (int i = 0; i < categoryCount; i++)
+  {
+    lastFrameCounts[i] = currentCounts[i].exchange(0);
+  }
+
+  frame++;
+}
+
+std::uint64_t GLDebugOutput::frameCount(GLDebugCategory category) const
+{
+  return lastFrameCounts[static_cast<int>(category)];
+}
+
+std::uint64_t GLDebugOutput::totalCount(GLDebugCategory category) const
+{
+  return totalCounts[static_cast<int>(category)].load();
+}
+
+std::uint64_t GLDebugOutput::framePerformanceWarnings() const
+{
+  return frameCount(GLDebugCategory::BufferStall) +
+    frameCount(GLDebugCategory::ShaderRecompile) +
+    frameCount(GLDebugCategory::Performance);
+}
+
+bool GLDebugOutput::nextMessage(GLDebugMessage& message)
+{
+  Slot& slot = slots[readPosition % capacity];
+  if (slot.sequence.load(std::memory_order_acquire) != readPosition + 1)
+  {
+    return false;
+  }
+
+  message = slot.message;
+  slot.sequence.store(readPosition + capacity, std::memory_order_release);
+  readPosition++;
+  return true;
+}
+
+const char* GLDebugOutput::categoryName(GLDebugCategory category)
+{
+  switch (category)
+  {
+    case GLDebugCategory::Error: return "error";
+    case GLDebugCategory::BufferStall: return "buffer stall";
+    case GLDebugCategory::ShaderRecompile: return "shader recompile";
+    case GLDebugCategory::Performance: return "performance";
+    case GLDebugCategory::UndefinedBehaviour: return "undefined behaviour";
+    case GLDebugCategory::Deprecated: return "deprecated";
+    case GLDebugCategory::Portability: return "portability";
+    case GLDebugCategory::ShaderCompiler: return "shader compiler";
+    default: return "other";
+  }
+}
+
+void APIENTRY GLDebugOutput::callback(
+  GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+  const GLchar* message, const void* userParam)
+{
+  GLDebugOutput* output =
+    static_cast<GLDebugOutput*>(const_cast<void*>(userParam));
+
+  const std::size_t messageLength = length >= 0
+    ? static_cast<std::size_t>(length) : std::strlen(message);
+  output->push(source, type, id, severity, message, messageLength);
+}
+
+GLDebugCategory GLDebugOutput::categorize(
+  GLenum source, GLenum type, const GLchar* message, std::size_t length)
+{
+  // Whether the message has the word in it, ignoring case.
+  const auto mentions = [message, length](const char* word)
+  {
+    const std::size_t wordLength = std::strlen(word);
+    for (std::size_t i = 0; i + wordLength <= length; i++)
+    {
+      std::size_t j = 0;
+      while (j < wordLength &&
+             (message[i + j] | 0x20) == word[j])
+      {
+        j++;
+      }
+
+      if (j == wordLength) return true;
+    }
+
+    return false;
+  };
+
+  if (source == GL_DEBUG_SOURCE_SHADER_COMPILER)
+  {
+    return GLDebugCategory::ShaderCompiler;
+  }
+
+  switch (type)
+  {
+    case GL_DEBUG_TYPE_ERROR:
+      return GLDebugCategory::Error;
+    case GL_DEBUG_TYPE_PERFORMANCE:
+      if (mentions("recompil")) return GLDebugCategory::ShaderRecompile;
+      if (mentions("stall") || mentions("synchroniz") || mentions("busy") ||
+          mentions("wait") || mentions("blocking") || mentions("copied"))
+      {
+        return GLDebugCategory::BufferStall;
+      }
+      return GLDebugCategory::Performance;
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+      return GLDebugCategory::UndefinedBehaviour;
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+      return GLDebugCategory::Deprecated;
+    case GL_DEBUG_TYPE_PORTABILITY:
+      return GLDebugCategory::Portability;
+    default:
+      return GLDebugCategory::Other;
+  }
+}
+
+void GLDebugOutput::push(
+  GLenum source, GLenum type, GLuint id, GLenum severity,
+  const GLchar* message, std::size_t length)
+{
+  const GLDebugCategory category = categorize(source, type, message, length);
+  currentCounts[static_cast<int>(category)]++;
+  totalCounts[static_cast<int>(category)]++;
+
+  // Claim the slot of the next position, unless the reader has not taken
+  // the message which was last in it yet.
+  std::size_t position = pushPosition.load(std::memory_order_relaxed);
+  Slot* slot;
+  while (true)
+  {
+    slot = &slots[position % capacity];
+    const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(
+      slot->sequence.load(std::memory_order_acquire) - position);
+
+    if (difference == 0)
+    {
+      if (pushPosition.compare_exchange_weak(
+            position, position + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (difference < 0)
+    {
+      droppedMessages++;
+      return;
+    }
+    else
+    {
+      position = pushPosition.load(std::memory_order_relaxed);
+    }
+  }
+
+  GLDebugMessage& stored = slot->message;
+  stored.category = category;
+  stored.source = source;
+  stored.type = type;
+  stored.severity = severity;
+  stored.id = id;
+  stored.frame = frame.load(std::memory_order_relaxed);
+
+  const std::size_t copied = length < GLDebugMessage::maxLength
+    ? length : GLDebugMessage::maxLength;
+  std::memcpy(stored.text, message, copied);
+  stored.text[copied] = '\0';
+
+  slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+void printDebugMessages(std::ostream& out)
+{
+  GLDebugOutput& output = GLDebugOutput::instance();
+
+  GLDebugMessage message;
+  while (output.nextMessage(message))
+  {
+    out << "GL " << GLDebugOutput::categoryName(message.category)
+        << " (frame " << message.frame << "): " << message.text << std::endl;
+  }
+
+  if (output.framePerformanceWarnings() > 0)
+  {
+    out << "Performance warnings in the last frame: "
+        << output.framePerformanceWarnings() << " (buffer stalls: "
+        << output.frameCount(GLDebugCategory::BufferStall)
+        << ", shader recompiles: "
+        << output.frameCount(GLDebugCategory::ShaderRecompile) << ")"
+        << std::endl;
+  }
+}
@@ -0,0 +1,135 @@
+#ifndef __OPENGL_TUTORIAL_GL_DEBUG_H__
+#define __OPENGL_TUTORIAL_GL_DEBUG_H__
+
+#include "glad/glad.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+
+// What a debug message from the driver is about. Performance warnings are
+// split by what they warn of, going by the words of the message, since
+// drivers give them no other way to tell them apart.
+enum class GLDebugCategory
+{
+  Error,
+  BufferStall,      // waiting for the GPU, or copying, to access a buffer
+  ShaderRecompile,  // a shader recompiled for the current state
+  Performance,      // any other performance warning
+  UndefinedBehaviour,
+  Deprecated,
+  Portability,
+  ShaderCompiler,   // compile and link warnings and errors
+  Other,            // notifications, markers and debug groups
+  Count
+};
+
+// A message taken from GLDebugOutput, cut short if it was long.
+struct GLDebugMessage
+{
+  static constexpr std::size_t maxLength = 255;
+
+  GLDebugCategory category;
+  GLenum source;
+  GLenum type;
+  GLenum severity;
+  GLuint id;
+
+  // The frame the message arrived in, counting endFrame() calls from 0.
+  std::uint64_t frame;
+
+  char text[maxLength + 1];
+};
+
+// Collects the messages the driver sends through KHR_debug. The callback
+// only categorizes a message, counts it for the current frame and copies it
+// into a fixed ring buffer, so it never allocates, prints or takes a lock
+// and can be called on any of the driver's threads. The messages are taken
+// out and the counts read on the render thread. When the ring is full new
+// messages are only counted.
+//
+// It is opt in: LEARNOGL_GL_DEBUG in the environment asks for a debug
+// context (see requested()), which drivers send far more messages for.
+class GLDebugOutput
+{
+public:
+  // The collector shared by every context in the process.
+  static GLDebugOutput& instance();
+
+  // Whether LEARNOGL_GL_DEBUG is set (and not "0"). Ask for a debug context
+  // when creating the window if it is.
+  static bool requested();
+
+  // Send the messages of the current context here, including the low
+  // severity ones drivers leave out by default. Synchronous output makes the
+  // driver call back on the thread which made the call, at some cost.
+  // Returns false if the context has no KHR_debug.
+  bool install(bool synchronous = false);
+
+  // Stop sending the messages of the current context here.
+  void uninstall();
+
+  // End the current frame: its counts become those of the last frame. Call
+  // it straight after glfwSwapBuffers.
+  void endFrame();
+
+  // The messages of a category in the last frame which ended, and in total.
+  std::uint64_t frameCount(GLDebugCategory category) const;
+  std::uint64_t totalCount(GLDebugCategory category) const;
+
+  // The performance warnings of every kind in the last frame.
+  std::uint64_t framePerformanceWarnings() const;
+
+  // The messages which did not fit in the ring, in total.
+  std::uint64_t dropped() const { return droppedMessages.load(); }
+
+  // Take the oldest message out of the ring. Returns false if it is empty.
+  // Only call it on one thread at a time.
+  bool nextMessage(GLDebugMessage& message);
+
+  static const char* categoryName(GLDebugCategory category);
+
+private:
+  static constexpr std::size_t capacity = 256;
+  static constexpr int categoryCount = static_cast<int>(GLDebugCategory::Count);
+
+  GLDebugOutput();
+
+  static void APIENTRY callback(
+    GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+    const GLchar* message, const void* userParam);
+
+  static GLDebugCategory categorize(
+    GLenum source, GLenum type, const GLchar* message, std::size_t length);
+
+  void push(
+    GLenum source, GLenum type, GLuint id, GLenum severity,
+    const GLchar* message, std::size_t length);
+
+  // A bounded queue which any number of threads can push to without locks:
+  // each slot's sequence says whether it is free for the push of a position,
+  // or holds the message of a position for the reader.
+  struct Slot
+  {
+    std::atomic<std::size_t> sequence;
+    GLDebugMessage message;
+  };
+
+  Slot slots[capacity];
+  std::atomic<std::size_t> pushPosition{ 0 };
+  std::size_t readPosition = 0;
+  std::atomic<std::uint64_t> droppedMessages{ 0 };
+
+  std::atomic<std::uint64_t> frame{ 0 };
+  std::atomic<std::uint64_t> currentCounts[categoryCount] = {};
+  std::uint64_t lastFrameCounts[categoryCount] = {};
+  std::atomic<std::uint64_t> totalCounts[categoryCount] = {};
+};
+
+// Print the messages collected since the last call, then the performance
+// warnings of the last frame if there were any. Call it between frames.
+void printDebugMessages(std::ostream& out);
+
+#endif // __OPENGL_TUTORIAL_GL_DEBUG_H__
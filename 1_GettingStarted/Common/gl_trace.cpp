@@ -0,0 +1,29 @@
+#include "gl_trace.h"
+
+GLTraceCapture::GLTraceCapture()
+{
+#ifdef GLAD_TRACE_CALLS
+  const char* path = std::getenv("LEARNOGL_GL_TRACE");
+  if (path == nullptr || *path == '\0') return;
+
+  tracing = gladTraceBegin(path) != 0;
+  if (!tracing)
+  {
+    std::cout << "Failed to start a GL trace in " << path << std::endl;
+  }
+#endif
+}
+
+GLTraceCapture::~GLTraceCapture()
+{
+#ifdef GLAD_TRACE_CALLS
+  if (tracing) gladTraceEnd();
+#endif
+}
+
+void GLTraceCapture::frame()
+{
+#ifdef GLAD_TRACE_CALLS
+  if (tracing) gladTraceFrame();
+#endif
+}
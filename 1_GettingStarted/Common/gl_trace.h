@@ -0,0 +1,32 @@
+#ifndef __OPENGL_TUTORIAL_GL_TRACE_H__
+#define __OPENGL_TUTORIAL_GL_TRACE_H__
+
+#include "glad/glad.h"
+#include <cstdlib>
+#include <iostream>
+
+// Writes the GL calls of a run to a trace which GLReplay can run again
+// headlessly, when glad is built with GLAD_TRACE_CALLS (the
+// LEARNOGL_TRACE_GL_CALLS option in CMake) and the LEARNOGL_GL_TRACE
+// environment variable names the file to write. Otherwise it does nothing.
+class GLTraceCapture
+{
+public:
+  // Start tracing. Create it straight after glad has been loaded, so that the
+  // trace creates every object it uses.
+  GLTraceCapture();
+
+  // Stop tracing.
+  ~GLTraceCapture();
+
+  GLTraceCapture(const GLTraceCapture&) = delete;
+  GLTraceCapture& operator=(const GLTraceCapture&) = delete;
+
+  // Mark the end of a frame. Call it straight after glfwSwapBuffers.
+  void frame();
+
+private:
+  bool tracing = false;
+};
+
+#endif // __OPENGL_TUTORIAL_GL_TRACE_H__
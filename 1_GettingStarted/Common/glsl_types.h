@@ -0,0 +1,20 @@
+#ifndef __OPENGL_TUTORIAL_GLSL_TYPES_H__
+#define __OPENGL_TUTORIAL_GLSL_TYPES_H__
+
+// Plain C++ counterparts of the GLSL vector and matrix types, used to pass
+// values to uniforms. Matrices are stored column by column, as GL expects.
+namespace glsl
+{
+  struct vec2 { float x, y; };
+  struct vec3 { float x, y, z; };
+  struct vec4 { float x, y, z, w; };
+
+  struct ivec2 { int x, y; };
+  struct ivec3 { int x, y, z; };
+  struct ivec4 { int x, y, z, w; };
+
+  struct mat3 { float m[9]; };
+  struct mat4 { float m[16]; };
+}
+
+#endif // __OPENGL_TUTORIAL_GLSL_TYPES_H__
@@ -0,0 +1,39 @@
+#ifndef __OPENGL_TUTORIAL_HASH_H__
+#define __OPENGL_TUTORIAL_HASH_H__
+
+#include <cstdint>
+#include <string_view>
+
+// 64-bit FNV-1a hash used to identify shader sources by their content.
+// Pass the previous result as the seed to hash several pieces of data in turn.
+constexpr std::uint64_t FNV_OFFSET_BASIS_64 = 14695981039346656037ull;
+
+constexpr std::uint64_t hashContent(
+  std::string_view data,
+  std::uint64_t seed = FNV_OFFSET_BASIS_64)
+{
+  std::uint64_t hash = seed;
+  for (char c : data)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ull;
+  }
+
+  return hash;
+}
+
+// Hash a piece of data followed by its length, so that consecutive pieces
+// cannot be confused with each other (e.g. "ab" + "c" and "a" + "bc").
+constexpr std::uint64_t hashField(std::string_view data, std::uint64_t seed)
+{
+  std::uint64_t hash = hashContent(data, seed);
+  for (std::uint64_t n = data.size(), i = 0; i < 8; i++, n >>= 8)
+  {
+    hash ^= n & 0xFF;
+    hash *= 1099511628211ull;
+  }
+
+  return hash;
+}
+
+#endif // __OPENGL_TUTORIAL_HASH_H__
@@ -0,0 +1,214 @@
+#include "program_cache.h"
+
+ProgramCache::ProgramCache(std::string directory) :
+  directory(std::move(directory))
+{
+}
+
+ProgramCache& ProgramCache::instance()
+{
+  static ProgramCache cache(defaultDirectory());
+  return cache;
+}
+
+std::string ProgramCache::defaultDirectory()
+{
+  if (const char* directory = std::getenv("LEARNOGL_SHADER_CACHE"))
+  {
+    return directory;
+  }
+
+  // The XDG base directory specification's user cache, so that running an
+  // exercise never leaves files in the working directory.
+  const char* xdgCache = std::getenv("XDG_CACHE_HOME");
+  if (xdgCache != nullptr && xdgCache[0] == '/')
+  {
+    return (std::filesystem::path(xdgCache) / "learnogl" / "shaders").string();
+  }
+
+  const char* home = std::getenv("HOME");
+  if (home != nullptr && home[0] != '\0')
+  {
+    return (std::filesystem::path(home) / ".cache" / "learnogl" / "shaders")
+      .string();
+  }
+
+  // Nowhere to put it.
+  return std::string();
+}
+
+bool ProgramCache::enabled() const
+{
+  if (directory.empty()) return false;
+  if (driverState.load(std::memory_order_acquire) == Unknown) queryDriver();
+  return driverState.load(std::memory_order_acquire) == Enabled;
+}
+
+void ProgramCache::contextChanged()
+{
+  driverState.store(Unknown, std::memory_order_release);
+}
+
+void ProgramCache::queryDriver() const
+{
+  // Some drivers expose the extension without supporting any binary formats.
+  int formats = 0;
+  if (GLAD_GL_ARB_get_program_binary)
+  {
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+  }
+
+  std::uint64_t hash = FNV_OFFSET_BASIS_64;
+  hash = hashField(glString(GL_VENDOR), hash);
+  hash = hashField(glString(GL_RENDERER), hash);
+  hash = hashField(glString(GL_VERSION), hash);
+
+  driverHash.store(hash, std::memory_order_relaxed);
+  driverState.store(formats > 0 ? Enabled : Disabled, std::memory_order_release);
+}
+
+std::uint64_t ProgramCache::key(
+  std::string_view vertexCode,
+  std::string_view fragmentCode) const
+{
+  return key(driverKey(), vertexCode, fragmentCode);
+}
+
+std::uint64_t ProgramCache::driverKey() const
+{
+  if (driverState.load(std::memory_order_acquire) == Unknown) queryDriver();
+  return driverHash.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ProgramCache::key(
+  std::uint64_t driver,
+  std::string_view vertexCode,
+  std::string_view fragmentCode)
+{
+  std::uint64_t hash = hashField(vertexCode, driver);
+  hash = hashField(fragmentCode, hash);
+  return hash;
+}
+
+unsigned int ProgramCache::load(std::uint64_t key, bool separable) const
+{
+  const std::filesystem::path path = entryPath(key);
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return 0;
+
+  Header header;
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+   || std::string_view(header.magic, 8) != std::string_view(MAGIC, 8)
+   || header.key != key)
+  {
+    return 0;
+  }
+
+  // The length is only trusted once the file is known to hold that much, so
+  // that a truncated or corrupt entry cannot ask for a huge allocation.
+  std::error_code error;
+  const std::uintmax_t size = std::filesystem::file_size(path, error);
+  if (error || size != sizeof(header) + std::uintmax_t(header.length))
+  {
+    remove(path);
+    return 0;
+  }
+
+  std::vector<char> binary(header.length);
+  if (!file.read(binary.data(), binary.size()))
+  {
+    remove(path);
+    return 0;
+  }
+
+  unsigned int program = glCreateProgram();
+  if (separable) glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+  glProgramBinary(program, header.format, binary.data(), header.length);
+
+  int success;
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success)
+  {
+    // The driver no longer accepts this binary, so rebuild it next time.
+    glDeleteProgram(program);
+    remove(path);
+    return 0;
+  }
+
+  return program;
+}
+
+void ProgramCache::store(std::uint64_t key, unsigned int program) const
+{
+  int length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0) return;
+
+  Header header;
+  std::copy(MAGIC, MAGIC + 8, header.magic);
+  header.key = key;
+
+  std::vector<char> binary(length);
+  GLenum format = 0;
+  glGetProgramBinary(program, length, &length, &format, binary.data());
+  header.format = format;
+  header.length = std::uint32_t(length);
+
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  if (error) return;
+
+  // Write to a temporary file first so that a concurrent reader never sees a
+  // partially written entry. Its name is unique to this process and call, so
+  // that programs (or threads) storing the same entry at once don't write
+  // into each other's file.
+  static std::atomic<unsigned> stores{ 0 };
+  char suffix[48];
+  std::snprintf(
+    suffix,
+    sizeof(suffix),
+    ".%ld.%u.tmp",
+    long(getpid()),
+    stores.fetch_add(1, std::memory_order_relaxed));
+
+  const std::filesystem::path path = entryPath(key);
+  std::filesystem::path temporary = path;
+  temporary += suffix;
+  bool written;
+  {
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), length);
+    file.close();
+    written = bool(file);
+  }
+
+  // Don't leave a temporary file behind which nothing will ever replace.
+  if (!written)
+  {
+    remove(temporary);
+    return;
+  }
+
+  std::filesystem::rename(temporary, path, error);
+  if (error) remove(temporary);
+}
+
+std::string_view ProgramCache::glString(GLenum name)
+{
+  const char* value = reinterpret_cast<const char*>(glGetString(name));
+  return value ? std::string_view(value) : std::string_view();
+}
+
+void ProgramCache::remove(const std::filesystem::path& path)
+{
+  std::error_code ignored;
+  std::filesystem::remove(path, ignored);
+}
+
+std::filesystem::path ProgramCache::entryPath(std::uint64_t key) const
+{
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+  return std::filesystem::path(directory) / name;
+}
@@ -0,0 +1,100 @@
+#ifndef __OPENGL_TUTORIAL_PROGRAM_CACHE_H__
+#define __OPENGL_TUTORIAL_PROGRAM_CACHE_H__
+
+#include "glad/glad.h"
+#include "hash.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unistd.h>
+
+// Persistent cache of linked program binaries.
+// Programs are stored with glGetProgramBinary and restored with
+// glProgramBinary, keyed by a hash of the shader sources and the driver
+// identification strings (a driver update invalidates every entry).
+// The cache directory defaults to learnogl/shaders under $XDG_CACHE_HOME
+// (or ~/.cache), and can be moved with the LEARNOGL_SHADER_CACHE environment
+// variable; set it to an empty string to disable the cache. Whether it is
+// enabled, and the driver's part of the key, are only asked of the driver
+// once per context.
+class ProgramCache
+{
+public:
+  explicit ProgramCache(std::string directory);
+
+  // The cache shared by every Shader in the process.
+  static ProgramCache& instance();
+
+  // The directory instance() uses, from the environment (empty if there is
+  // nowhere to put it).
+  static std::string defaultDirectory();
+
+  bool enabled() const;
+
+  // Forget what was asked of the driver, when a new context is made.
+  void contextChanged();
+
+  // Compute the cache key of a program built from the given sources.
+  std::uint64_t key(
+    std::string_view vertexCode,
+    std::string_view fragmentCode) const;
+
+  // The part of the key which identifies the driver. Only this needs the GL
+  // context, so the rest of the key can be computed on any thread.
+  std::uint64_t driverKey() const;
+
+  static std::uint64_t key(
+    std::uint64_t driver,
+    std::string_view vertexCode,
+    std::string_view fragmentCode);
+
+  // Restore a program from the cache. Returns 0 if there is no entry, or if
+  // it is truncated or the driver rejects the stored binary (in which case
+  // the entry is removed).
+  // Separable programs must be marked as such before the binary is loaded.
+  unsigned int load(std::uint64_t key, bool separable = false) const;
+
+  // Store a linked program. It must have been linked with
+  // GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+  void store(std::uint64_t key, unsigned int program) const;
+
+private:
+  // Identifies the file format of a cache entry.
+  static constexpr char MAGIC[8] = { 'L', 'O', 'G', 'L', 'P', 'B', '0', '1' };
+
+  // Every entry starts with this header, followed by the binary itself.
+  struct Header
+  {
+    char magic[8];
+    std::uint64_t key;
+    std::uint32_t format;
+    std::uint32_t length;
+  };
+
+  std::string directory;
+
+  // What was asked of the driver: whether the cache can be used, and if so
+  // the hash of its strings. Several threads with contexts of their own may
+  // ask at once, and get the same answers.
+  enum DriverState { Unknown, Disabled, Enabled };
+  mutable std::atomic<int> driverState{ Unknown };
+  mutable std::atomic<std::uint64_t> driverHash{ 0 };
+
+  void queryDriver() const;
+
+  static std::string_view glString(GLenum name);
+
+  std::filesystem::path entryPath(std::uint64_t key) const;
+
+  // Delete an entry which cannot be used, so that it is rebuilt next time.
+  static void remove(const std::filesystem::path& path);
+};
+
+#endif // __OPENGL_TUTORIAL_PROGRAM_CACHE_H__
@@ -0,0 +1,466 @@
+#include "shader.h"
+
+Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath) :
+  Shader(PendingShader::fromFiles(vertexPath, fragmentPath).get())
+{
+}
+
+Shader Shader::fromSource(
+  std::string_view vertexCode,
+  std::string_view fragmentCode)
+{
+  return PendingShader(vertexCode, fragmentCode).get();
+}
+
+std::atomic<std::uint64_t> Shader::nextGeneration{ 1 };
+thread_local unsigned int Shader::uniformTarget = 0;
+
+Shader::Shader(unsigned int program) :
+  ID(program),
+  programGeneration(nextGeneration++)
+{
+  uniforms.build(ID);
+  reflectAttributes();
+}
+
+void Shader::reflectAttributes()
+{
+  activeAttributes.clear();
+
+  int count = 0, maxLength = 0;
+  glGetProgramiv(ID, GL_ACTIVE_ATTRIBUTES, &count);
+  glGetProgramiv(ID, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+
+  std::vector<char> nameBuffer(std::max(maxLength, 1));
+  for (int i = 0; i < count; i++)
+  {
+    int length = 0, size = 0;
+    GLenum type = 0;
+    glGetActiveAttrib(
+      ID, i, maxLength, &length, &size, &type, nameBuffer.data());
+
+    std::string name(nameBuffer.data(), length);
+    int location = glGetAttribLocation(ID, name.c_str());
+
+    // Built-in inputs such as gl_VertexID have no location.
+    if (location < 0) continue;
+
+    activeAttributes.push_back({ std::move(name), location, type, size });
+  }
+
+  std::sort(activeAttributes.begin(), activeAttributes.end(),
+    [](const AttributeInfo& a, const AttributeInfo& b)
+    {
+      return a.location < b.location;
+    });
+
+  attributeHash = FNV_OFFSET_BASIS_64;
+  for (const AttributeInfo& attribute : activeAttributes)
+  {
+    const int fields[] =
+      { attribute.location, int(attribute.type), attribute.size };
+    attributeHash = hashField(attribute.name, attributeHash);
+    attributeHash = hashField(std::string_view(
+      reinterpret_cast<const char*>(fields), sizeof(fields)), attributeHash);
+  }
+}
+
+Shader::~Shader()
+{
+  if (ID != 0) glDeleteProgram(ID);
+
+  // GL may give the name to another program.
+  if (ID != 0 && uniformTarget == ID) uniformTarget = 0;
+}
+
+Shader::Shader(Shader&& other) noexcept :
+  ID(other.ID),
+  programGeneration(other.programGeneration),
+  uniforms(std::move(other.uniforms)),
+  activeAttributes(std::move(other.activeAttributes)),
+  attributeHash(other.attributeHash)
+{
+  other.ID = 0;
+  other.programGeneration = 0;
+}
+
+Shader& Shader::operator=(Shader&& other) noexcept
+{
+  if (this != &other)
+  {
+    if (ID != 0) glDeleteProgram(ID);
+    if (ID != 0 && uniformTarget == ID) uniformTarget = 0;
+    ID = other.ID;
+    programGeneration = other.programGeneration;
+    uniforms = std::move(other.uniforms);
+    activeAttributes = std::move(other.activeAttributes);
+    attributeHash = other.attributeHash;
+    other.ID = 0;
+    other.programGeneration = 0;
+  }
+
+  return *this;
+}
+
+PendingShader::PendingShader(
+  std::string_view vertexCode,
+  std::string_view fragmentCode)
+{
+  if (ProgramCache::instance().enabled())
+  {
+    cacheKey = ProgramCache::instance().key(vertexCode, fragmentCode);
+  }
+
+  build.name = "<memory>";
+  submit(
+    vertexCode,
+    fragmentCode,
+    ShaderObjectCache::key(GL_VERTEX_SHADER, vertexCode),
+    ShaderObjectCache::key(GL_FRAGMENT_SHADER, fragmentCode));
+}
+
+PendingShader::PendingShader(const PreparedProgram& prepared) :
+  cacheKey(prepared.cacheKey)
+{
+  build.name = prepared.name;
+  build.readMs = prepared.readMs;
+  submit(
+    prepared.vertexCode,
+    prepared.fragmentCode,
+    prepared.vertexKey,
+    prepared.fragmentKey);
+}
+
+PendingShader::PendingShader(GLenum type, std::string_view code) :
+  separable(true)
+{
+  if (type != GL_VERTEX_SHADER && type != GL_FRAGMENT_SHADER)
+  {
+    std::cout << "Only vertex and fragment stages can be built separately"
+              << std::endl;
+    throw std::exception();
+  }
+
+  // The missing stage is left empty, which no linked program can have, so
+  // the cache keys of stages and whole programs never collide.
+  const bool isVertex = type == GL_VERTEX_SHADER;
+  const std::string_view vertexCode = isVertex ? code : std::string_view();
+  const std::string_view fragmentCode = isVertex ? std::string_view() : code;
+
+  if (ProgramCache::instance().enabled())
+  {
+    cacheKey = ProgramCache::instance().key(vertexCode, fragmentCode);
+  }
+
+  build.name = "<memory>";
+  submit(
+    vertexCode,
+    fragmentCode,
+    ShaderObjectCache::key(GL_VERTEX_SHADER, vertexCode),
+    ShaderObjectCache::key(GL_FRAGMENT_SHADER, fragmentCode));
+}
+
+PendingShader PendingShader::fromStageFile(
+  GLenum type,
+  const std::string& path)
+{
+  ShaderTimer timer;
+  std::vector<ShaderSource> sources = loadShaderSources({ path });
+  const double readMs = timer.lap();
+
+  PendingShader pending(type, sources[0].view());
+  pending.build.name = path;
+  pending.build.readMs = readMs;
+  return pending;
+}
+
+void PendingShader::submit(
+  std::string_view vertexCode,
+  std::string_view fragmentCode,
+  std::uint64_t vertexKey,
+  std::uint64_t fragmentKey)
+{
+  build.sourceBytes = vertexCode.size() + fragmentCode.size();
+  ShaderTimer timer;
+
+  // Restore the program from the binary cache if it has been built before.
+  ProgramCache& cache = ProgramCache::instance();
+  const bool useCache = cache.enabled();
+  if (useCache)
+  {
+    program = cache.load(cacheKey, separable);
+    if (program != 0)
+    {
+      build.linkMs = timer.lap();
+      build.cacheHit = true;
+      return;
+    }
+  }
+
+  // Submit both stages and the link without asking for any results: a status
+  // query would make the driver finish the work before returning. Stages
+  // shared with other programs are only compiled once.
+  ShaderObjectCache& objects = ShaderObjectCache::instance();
+  timer.lap();
+  if (!vertexCode.empty())
+  {
+    vertex = objects.acquire(GL_VERTEX_SHADER, vertexCode, vertexKey);
+  }
+
+  build.vertexCompileMs = timer.lap();
+  if (!fragmentCode.empty())
+  {
+    fragment = objects.acquire(GL_FRAGMENT_SHADER, fragmentCode, fragmentKey);
+  }
+
+  build.fragmentCompileMs = timer.lap();
+
+  program = glCreateProgram();
+  if (vertex != 0) glAttachShader(program, vertex);
+  if (fragment != 0) glAttachShader(program, fragment);
+  if (separable) glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+  if (useCache)
+  {
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    storeInCache = true;
+  }
+
+  glLinkProgram(program);
+  build.linkMs = timer.lap();
+}
+
+PendingShader PendingShader::fromFiles(
+  const std::string& vertexPath,
+  const std::string& fragmentPath)
+{
+  ShaderTimer timer;
+  std::vector<ShaderSource> sources =
+    loadShaderSources({ vertexPath, fragmentPath });
+  const double readMs = timer.lap();
+
+  PendingShader pending(sources[0].view(), sources[1].view());
+  pending.build.name = vertexPath + " + " + fragmentPath;
+  pending.build.readMs = readMs;
+  return pending;
+}
+
+PendingShader::~PendingShader()
+{
+  release();
+}
+
+PendingShader::PendingShader(PendingShader&& other) noexcept :
+  program(other.program),
+  vertex(other.vertex),
+  fragment(other.fragment),
+  storeInCache(other.storeInCache),
+  cacheKey(other.cacheKey),
+  separable(other.separable),
+  build(std::move(other.build))
+{
+  other.program = other.vertex = other.fragment = 0;
+}
+
+PendingShader& PendingShader::operator=(PendingShader&& other) noexcept
+{
+  if (this != &other)
+  {
+    release();
+    program = other.program;
+    vertex = other.vertex;
+    fragment = other.fragment;
+    storeInCache = other.storeInCache;
+    cacheKey = other.cacheKey;
+    separable = other.separable;
+    build = std::move(other.build);
+    other.program = other.vertex = other.fragment = 0;
+  }
+
+  return *this;
+}
+
+bool PendingShader::ready() const
+{
+  if (!GLAD_GL_KHR_parallel_shader_compile || program == 0) return true;
+
+  int complete = GL_TRUE;
+  glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &complete);
+  return complete == GL_TRUE;
+}
+
+Shader PendingShader::get()
+{
+  // The program has already been taken, by an earlier get() or a move.
+  if (program == 0)
+  {
+    std::cout << "Pending shader has no program to get" << std::endl;
+    throw std::exception();
+  }
+
+  int success = 0;
+  char infoLog[512];
+
+  // Wait for each stage in turn, so that the time spent waiting for the
+  // driver can be put down to the stage it was compiling.
+  ShaderTimer timer;
+  if (vertex != 0)
+  {
+    glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+    build.vertexCompileMs += timer.lap();
+    if (!success)
+    {
+      glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+      std::cout << "Vertex shader compilation failed: " << infoLog << std::endl;
+      fail(infoLog);
+    }
+  }
+
+  if (fragment != 0)
+  {
+    glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+    build.fragmentCompileMs += timer.lap();
+    if (!success)
+    {
+      glGetShaderInfoLog(fragment, 512, NULL, infoLog);
+      std::cout << "Fragment shader compilation failed: " << infoLog << std::endl;
+      fail(infoLog);
+    }
+  }
+
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  build.linkMs += timer.lap();
+  if (!success)
+  {
+    glGetProgramInfoLog(program, 512, NULL, infoLog);
+    std::cout << "Program linking failed: " << infoLog << std::endl;
+    fail(infoLog);
+  }
+
+  ShaderTelemetry::instance().record(std::move(build));
+
+  if (storeInCache)
+  {
+    ProgramCache::instance().store(cacheKey, program);
+  }
+
+  // The linked program keeps working once its shaders are gone.
+  if (vertex != 0)
+  {
+    glDetachShader(program, vertex);
+    ShaderObjectCache::instance().release(vertex);
+  }
+
+  if (fragment != 0)
+  {
+    glDetachShader(program, fragment);
+    ShaderObjectCache::instance().release(fragment);
+  }
+
+  vertex = fragment = 0;
+
+  unsigned int linked = program;
+  program = 0;
+  return Shader(linked);
+}
+
+void PendingShader::fail(const char* message)
+{
+  ShaderTelemetry::instance().recordFailure(std::move(build), message);
+  release();
+  throw std::exception();
+}
+
+void PendingShader::release()
+{
+  if (vertex != 0) ShaderObjectCache::instance().release(vertex);
+  if (fragment != 0) ShaderObjectCache::instance().release(fragment);
+  if (program != 0) glDeleteProgram(program);
+  program = vertex = fragment = 0;
+}
+
+std::vector<PendingShader> submitShaders(const std::vector<ShaderFiles>& files)
+{
+  // Let the driver use as many compiler threads as it likes.
+  if (GLAD_GL_KHR_parallel_shader_compile)
+  {
+    glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+  }
+
+  std::vector<std::string> paths;
+  paths.reserve(files.size() * 2);
+  for (const ShaderFiles& program : files)
+  {
+    paths.push_back(program.vertexPath);
+    paths.push_back(program.fragmentPath);
+  }
+
+  std::vector<ShaderSource> sources = loadShaderSources(paths);
+
+  std::vector<PendingShader> pending;
+  pending.reserve(files.size());
+  for (std::size_t i = 0; i < files.size(); i++)
+  {
+    pending.emplace_back(sources[2*i].view(), sources[2*i + 1].view());
+  }
+
+  return pending;
+}
+
+void Shader::use()
+{
+  glUseProgram(ID);
+  uniformTarget = ID;
+}
+
+int Shader::uniformLocation(std::string_view name) const
+{
+  return uniforms.find(name);
+}
+
+void Shader::setBool(std::string_view name, bool value) const
+{
+  setBool(uniforms.find(name), value);
+}
+
+void Shader::setInt(std::string_view name, int value) const
+{
+  setInt(uniforms.find(name), value);
+}
+
+void Shader::setFloat(std::string_view name, float value) const
+{
+  setFloat(uniforms.find(name), value);
+}
+
+void Shader::setBool(int location, bool value) const
+{
+  setInt(location, int(value));
+}
+
+bool Shader::shadow(
+  int location,
+  const void* value,
+  std::size_t size) const
+{
+  // glUniform* goes to whichever program is bound, so a value set while
+  // another one is in use never reached this program.
+  if (uniformTarget != ID) return true;
+
+  return uniforms.update(location, value, size);
+}
+
+void Shader::setInt(int location, int value) const
+{
+  if (shadow(location, &value, sizeof(value)))
+  {
+    glUniform1i(location, value);
+  }
+}
+
+void Shader::setFloat(int location, float value) const
+{
+  if (shadow(location, &value, sizeof(value)))
+  {
+    glUniform1f(location, value);
+  }
+}
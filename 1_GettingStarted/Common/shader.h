@@ -2,10 +2,28 @@
 #define __OPENGL_TUTORIAL_SHADER_H__
 
 #include "glad/glad.h"
+#include "hash.h"
+#include "program_cache.h"
+#include "shader_object_cache.h"
+#include "shader_source.h"
+#include "shader_telemetry.h"
+#include "uniform_table.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <string>
-#include <sstream>
+#include <string_view>
 #include <iostream>
-#include <fstream>
+#include <vector>
+
+// An active vertex attribute of a linked program.
+struct AttributeInfo
+{
+  std::string name;
+  int location;
+  GLenum type;
+  int size;
+};
 
 class Shader
 {
@@ -16,114 +34,200 @@ public:
   // Constructor reads and builds the shader.
   Shader(const std::string& vertexPath, const std::string& fragmentPath);
 
+  // Build the shader from source code which is already in memory (for
+  // example sources embedded with embed_shaders() in CMake).
+  static Shader fromSource(
+    std::string_view vertexCode,
+    std::string_view fragmentCode);
+
+  // The shader owns its program, so it can be moved but not copied.
+  ~Shader();
+  Shader(Shader&& other) noexcept;
+  Shader& operator=(Shader&& other) noexcept;
+  Shader(const Shader&) = delete;
+  Shader& operator=(const Shader&) = delete;
+
   // Use/activate the shader.
   void use();
 
-  // Utility uniform functions.
-  void setBool(const std::string& name, bool value) const;
-  void setInt(const std::string& name, int value) const;
-  void setFloat(const std::string& name, float value) const;
-};
+  // Tell Shader which program glUniform* calls on this thread now go to,
+  // after binding one without use() (with glUseProgram, or
+  // glActiveShaderProgram on a bound pipeline). 0 if it is not known.
+  static void setUniformTarget(unsigned int program)
+  {
+    uniformTarget = program;
+  }
 
-Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
-{
-  // 1. Retrieve the vertex and fragment shader source code from the files.
-  std::string vertexCode, fragmentCode;
-  std::ifstream vShaderFile, fShaderFile;
-  vShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-  fShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  // Changes whenever the shader is given another program, for example when
+  // ShaderWatcher reloads it. Unlike ID it is never reused: GL may give a new
+  // program the name of one which has been deleted.
+  std::uint64_t generation() const { return programGeneration; }
 
-  try
+  // Look up the location of a uniform once so that it can be passed to the
+  // setters below (-1 if the program has no such uniform).
+  int uniformLocation(std::string_view name) const;
+
+  // Everything known about a uniform (nullptr if the program has none).
+  const UniformInfo* uniformInfo(std::string_view name) const
   {
-    vShaderFile.open(vertexPath);
-    fShaderFile.open(fragmentPath);
+    return uniforms.info(name);
+  }
 
-    std::stringstream vShaderStream, fShaderStream;
+  const UniformInfo* uniformInfo(
+    std::string_view name,
+    std::uint32_t hash) const
+  {
+    return uniforms.info(name, hash);
+  }
 
-    vShaderStream << vShaderFile.rdbuf();
-    fShaderStream << fShaderFile.rdbuf();
+  // Utility uniform functions. Setting a uniform to the value it already has
+  // makes no GL call. Values are only remembered while the shader is the
+  // uniform target (see use() and setUniformTarget()), so setting one with
+  // another program bound does not stop it being sent again later.
+  void setBool(std::string_view name, bool value) const;
+  void setInt(std::string_view name, int value) const;
+  void setFloat(std::string_view name, float value) const;
 
-    vShaderFile.close();
-    fShaderFile.close();
+  void setBool(int location, bool value) const;
+  void setInt(int location, int value) const;
+  void setFloat(int location, float value) const;
 
-    vertexCode = vShaderStream.str();
-    fragmentCode = fShaderStream.str();
-  }
-  catch (std::ifstream::failure e)
+  // The program's active vertex attributes, ordered by location.
+  const std::vector<AttributeInfo>& attributes() const
   {
-    std::cout << "Failed to read shader file: " << e.what() << std::endl;
-    throw;
+    return activeAttributes;
   }
 
-  const char* vShaderCode = vertexCode.c_str();
-  const char* fShaderCode = fragmentCode.c_str();
+  // A hash of the attribute names, locations and types. Programs with the
+  // same value can be fed from the same vertex arrays.
+  std::uint64_t attributeLayout() const { return attributeHash; }
 
-  // 2. Compile the shaders (and check for errors).
-  unsigned int vertex, fragment;
-  int success;
-  char infoLog[512];
+private:
+  friend class PendingShader;
 
-  vertex = glCreateShader(GL_VERTEX_SHADER);
-  glShaderSource(vertex, 1, &vShaderCode, NULL);
-  glCompileShader(vertex);
+  template <typename T>
+  friend class Uniform;
 
-  glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
-  if (!success)
-  {
-    glGetShaderInfoLog(vertex, 512, NULL, infoLog);
-    std::cout << "Vertex shader compilation failed: " << infoLog << std::endl;
-    throw std::exception();
-  }
+  // Take ownership of a successfully linked program.
+  explicit Shader(unsigned int program);
 
-  fragment = glCreateShader(GL_FRAGMENT_SHADER);
-  glShaderSource(fragment, 1, &fShaderCode, NULL);
-  glCompileShader(fragment);
+  std::uint64_t programGeneration = 0;
+  static std::atomic<std::uint64_t> nextGeneration;
 
-  glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
-  if (!success)
-  {
-    glGetShaderInfoLog(fragment, 512, NULL, infoLog);
-    std::cout << "Fragment shader compilation failed: " << infoLog << std::endl;
-    throw std::exception();
-  }
+  // The program glUniform* calls go to in the context current on this
+  // thread, kept here so that checking it needs no glGet.
+  static thread_local unsigned int uniformTarget;
 
-  // Finally compile the shader program.
-  ID = glCreateProgram();
-  glAttachShader(ID, vertex);
-  glAttachShader(ID, fragment);
-  glLinkProgram(ID);
+  // The program's active uniforms, read once after linking.
+  UniformTable uniforms;
 
-  // Check for linking errors.
-  glGetProgramiv(ID, GL_LINK_STATUS, &success);
-  if (!success)
-  {
-    glGetProgramInfoLog(ID, 512, NULL, infoLog);
-    std::cout << "Program linking failed: " << infoLog << std::endl;
-    throw std::exception();
-  }
+  // The program's active attributes, also read once after linking.
+  std::vector<AttributeInfo> activeAttributes;
+  std::uint64_t attributeHash = 0;
 
-  glDeleteShader(vertex);
-  glDeleteShader(fragment);
-}
+  void reflectAttributes();
 
-void Shader::use()
-{
-  glUseProgram(ID);
-}
+  // Record a value about to be uploaded to a location, if this program is the
+  // uniform target. Returns false if the upload can be skipped.
+  bool shadow(int location, const void* value, std::size_t size) const;
+};
 
-void Shader::setBool(const std::string& name, bool value) const
+// The sources of a program, loaded and hashed ahead of time (possibly on
+// another thread) so that submitting them only has to call the driver.
+struct PreparedProgram
 {
-  glUniform1i(glGetUniformLocation(ID, name.c_str()), int(value));
-}
+  std::string vertexCode;
+  std::string fragmentCode;
 
-void Shader::setInt(const std::string& name, int value) const
+  // ShaderObjectCache keys of the stages.
+  std::uint64_t vertexKey;
+  std::uint64_t fragmentKey;
+
+  // ProgramCache key of the program.
+  std::uint64_t cacheKey = 0;
+
+  // For the build's ShaderBuildRecord.
+  std::string name;
+  double readMs = 0;
+};
+
+// A program which has been handed to the driver but may still be compiling.
+// Nothing here waits for the driver until get() is called, so many programs
+// can be submitted up front and compiled in parallel when the driver supports
+// GL_KHR_parallel_shader_compile.
+class PendingShader
 {
-  glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
-}
+public:
+  // Submit a program built from the given source code.
+  PendingShader(std::string_view vertexCode, std::string_view fragmentCode);
+
+  // Submit a program whose keys have already been computed.
+  explicit PendingShader(const PreparedProgram& prepared);
+
+  // Submit a single vertex or fragment stage as a separable program, to be
+  // combined with other stages in a program pipeline. Needs
+  // GL_ARB_separate_shader_objects.
+  PendingShader(GLenum type, std::string_view code);
+
+  // Map a source file and submit it as a separable program.
+  static PendingShader fromStageFile(GLenum type, const std::string& path);
+
+  // Map the source files and submit the program built from them.
+  static PendingShader fromFiles(
+    const std::string& vertexPath,
+    const std::string& fragmentPath);
+
+  ~PendingShader();
+  PendingShader(PendingShader&& other) noexcept;
+  PendingShader& operator=(PendingShader&& other) noexcept;
+  PendingShader(const PendingShader&) = delete;
+  PendingShader& operator=(const PendingShader&) = delete;
+
+  // Check whether get() can be called without blocking. Without
+  // GL_KHR_parallel_shader_compile this is always true and get() compiles
+  // synchronously.
+  bool ready() const;
 
-void Shader::setFloat(const std::string& name, float value) const
+  // Wait for the program to finish building and check it for errors.
+  // This can only be called once: later calls print a message and throw.
+  Shader get();
+
+private:
+  unsigned int program = 0;
+  unsigned int vertex = 0;
+  unsigned int fragment = 0;
+
+  // Set when the program has to be written to the binary cache once linked.
+  bool storeInCache = false;
+  std::uint64_t cacheKey = 0;
+
+  // Set for single stage programs.
+  bool separable = false;
+
+  // Filled in as the build goes, and recorded by get().
+  ShaderBuildRecord build;
+
+  void submit(
+    std::string_view vertexCode,
+    std::string_view fragmentCode,
+    std::uint64_t vertexKey,
+    std::uint64_t fragmentKey);
+
+  // Record the failed build, then release everything and throw.
+  void fail(const char* message);
+
+  void release();
+};
+
+// The source files of one program.
+struct ShaderFiles
 {
-  glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
-}
+  std::string vertexPath;
+  std::string fragmentPath;
+};
+
+// Map the source files of many programs in one batch and submit them all
+// before any of them is checked.
+std::vector<PendingShader> submitShaders(const std::vector<ShaderFiles>& files);
 
 #endif // __OPENGL_TUTORIAL_SHADER_H__
@@ -0,0 +1,136 @@
+#include "shader_combinations.h"
+
+ShaderCombinations::ShaderCombinations(bool allowSeparable) :
+  useSeparable(allowSeparable && GLAD_GL_ARB_separate_shader_objects)
+{
+}
+
+ShaderCombinations::~ShaderCombinations()
+{
+  for (const auto& pipeline : pipelines)
+  {
+    glDeleteProgramPipelines(1, &pipeline.second);
+  }
+}
+
+std::size_t ShaderCombinations::addVertex(const std::string& path)
+{
+  return add(GL_VERTEX_SHADER, path, vertexCode, vertexStages);
+}
+
+std::size_t ShaderCombinations::addFragment(const std::string& path)
+{
+  return add(GL_FRAGMENT_SHADER, path, fragmentCode, fragmentStages);
+}
+
+std::size_t ShaderCombinations::addVertexSource(std::string_view code)
+{
+  return addSource(GL_VERTEX_SHADER, code, vertexCode, vertexStages);
+}
+
+std::size_t ShaderCombinations::addFragmentSource(std::string_view code)
+{
+  return addSource(GL_FRAGMENT_SHADER, code, fragmentCode, fragmentStages);
+}
+
+std::size_t ShaderCombinations::add(
+  GLenum type,
+  const std::string& path,
+  std::vector<std::string>& code,
+  std::deque<Shader>& stages)
+{
+  if (useSeparable)
+  {
+    stages.push_back(PendingShader::fromStageFile(type, path).get());
+    links++;
+    return stages.size() - 1;
+  }
+
+  std::vector<ShaderSource> sources = loadShaderSources({ path });
+  code.emplace_back(sources[0].view());
+  return code.size() - 1;
+}
+
+std::size_t ShaderCombinations::addSource(
+  GLenum type,
+  std::string_view source,
+  std::vector<std::string>& code,
+  std::deque<Shader>& stages)
+{
+  if (useSeparable)
+  {
+    stages.push_back(PendingShader(type, source).get());
+    links++;
+    return stages.size() - 1;
+  }
+
+  code.emplace_back(source);
+  return code.size() - 1;
+}
+
+void ShaderCombinations::use(std::size_t vertex, std::size_t fragment)
+{
+  if (useSeparable)
+  {
+    unsigned int& id = pipelines[{ vertex, fragment }];
+    if (id == 0)
+    {
+      glGenProgramPipelines(1, &id);
+      glUseProgramStages(id, GL_VERTEX_SHADER_BIT, vertexStages[vertex].ID);
+      glUseProgramStages(
+        id, GL_FRAGMENT_SHADER_BIT, fragmentStages[fragment].ID);
+    }
+
+    // A program made current with glUseProgram would take precedence.
+    glUseProgram(0);
+    glBindProgramPipeline(id);
+    Shader::setUniformTarget(0);
+
+    pipeline = id;
+    currentVertex = &vertexStages[vertex];
+    currentFragment = &fragmentStages[fragment];
+    return;
+  }
+
+  auto program = programs.find({ vertex, fragment });
+  if (program == programs.end())
+  {
+    program = programs.emplace(
+      std::make_pair(vertex, fragment),
+      Shader::fromSource(vertexCode[vertex], fragmentCode[fragment])).first;
+
+    links++;
+  }
+
+  program->second.use();
+  currentProgram = &program->second;
+}
+
+void ShaderCombinations::setBool(std::string_view name, bool value)
+{
+  set(name, [value](const Shader& shader, auto uniform)
+  {
+    shader.setBool(uniform, value);
+  });
+}
+
+void ShaderCombinations::setInt(std::string_view name, int value)
+{
+  set(name, [value](const Shader& shader, auto uniform)
+  {
+    shader.setInt(uniform, value);
+  });
+}
+
+void ShaderCombinations::setFloat(std::string_view name, float value)
+{
+  set(name, [value](const Shader& shader, auto uniform)
+  {
+    shader.setFloat(uniform, value);
+  });
+}
+
+const Shader& ShaderCombinations::vertexProgram() const
+{
+  return useSeparable ? *currentVertex : *currentProgram;
+}
@@ -0,0 +1,131 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_COMBINATIONS_H__
+#define __OPENGL_TUTORIAL_SHADER_COMBINATIONS_H__
+
+#include "glad/glad.h"
+#include "shader.h"
+#include "shader_source.h"
+#include <deque>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Vertex and fragment shaders which can be used in any combination.
+// With GL_ARB_separate_shader_objects each stage is built once as a separable
+// program, and a combination is a program pipeline object made the first
+// time it is used, so N vertex and M fragment shaders need N + M links rather
+// than N x M. Otherwise each combination is linked into an ordinary program
+// the first time it is used.
+class ShaderCombinations
+{
+public:
+  // Separable programs are only used if allowed and supported.
+  explicit ShaderCombinations(bool allowSeparable = true);
+  ~ShaderCombinations();
+
+  ShaderCombinations(const ShaderCombinations&) = delete;
+  ShaderCombinations& operator=(const ShaderCombinations&) = delete;
+
+  // Load a stage and return its index among the stages of its type. Prints a
+  // message and throws if it cannot be read (or built, with separable
+  // programs).
+  std::size_t addVertex(const std::string& path);
+  std::size_t addFragment(const std::string& path);
+
+  // The same, with the stage's source code in memory.
+  std::size_t addVertexSource(std::string_view code);
+  std::size_t addFragmentSource(std::string_view code);
+
+  // Use the combination of the given stages for drawing.
+  void use(std::size_t vertex, std::size_t fragment);
+
+  // Set a uniform of the combination in use, in whichever stage declares it.
+  // Prints a message if use() has not been called.
+  void setBool(std::string_view name, bool value);
+  void setInt(std::string_view name, int value);
+  void setFloat(std::string_view name, float value);
+
+  // The program whose attributes the combination in use reads, for
+  // VertexArrayCache.
+  const Shader& vertexProgram() const;
+
+  bool separable() const { return useSeparable; }
+
+  // The number of programs linked so far.
+  std::size_t linkCount() const { return links; }
+
+private:
+  bool useSeparable;
+  std::size_t links = 0;
+
+  // The sources, kept for linking combinations when stages are not
+  // separable.
+  std::vector<std::string> vertexCode;
+  std::vector<std::string> fragmentCode;
+
+  // With separable programs: the stages, and a pipeline per combination.
+  // Deques, so that adding a stage leaves the current ones where they are.
+  std::deque<Shader> vertexStages;
+  std::deque<Shader> fragmentStages;
+  std::map<std::pair<std::size_t, std::size_t>, unsigned int> pipelines;
+
+  // Without: a linked program per combination.
+  std::map<std::pair<std::size_t, std::size_t>, Shader> programs;
+
+  // The combination in use.
+  unsigned int pipeline = 0;
+  Shader* currentVertex = nullptr;
+  Shader* currentFragment = nullptr;
+  Shader* currentProgram = nullptr;
+
+  std::size_t add(
+    GLenum type,
+    const std::string& path,
+    std::vector<std::string>& code,
+    std::deque<Shader>& stages);
+
+  std::size_t addSource(
+    GLenum type,
+    std::string_view source,
+    std::vector<std::string>& code,
+    std::deque<Shader>& stages);
+
+  // Calls setter(shader, name or location) on the program(s) which hold the
+  // uniform.
+  template <typename Setter>
+  void set(std::string_view name, Setter setter);
+};
+
+template <typename Setter>
+void ShaderCombinations::set(std::string_view name, Setter setter)
+{
+  if (currentVertex == nullptr && currentProgram == nullptr)
+  {
+    std::cout << "Cannot set uniform " << name << ": no combination of "
+              << "shaders is in use" << std::endl;
+    return;
+  }
+
+  if (!useSeparable)
+  {
+    setter(*currentProgram, name);
+    return;
+  }
+
+  // With no program in use, glUniform* sets the uniforms of the pipeline's
+  // active program. Telling Shader so lets it skip values the stage already
+  // has, as it does for a program made current with use().
+  for (Shader* stage : { currentVertex, currentFragment })
+  {
+    int location = stage->uniformLocation(name);
+    if (location < 0) continue;
+
+    glActiveShaderProgram(pipeline, stage->ID);
+    Shader::setUniformTarget(stage->ID);
+    setter(*stage, location);
+  }
+}
+
+#endif // __OPENGL_TUTORIAL_SHADER_COMBINATIONS_H__
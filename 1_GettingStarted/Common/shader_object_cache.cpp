@@ -0,0 +1,85 @@
+#include "shader_object_cache.h"
+
+ShaderObjectCache& ShaderObjectCache::instance()
+{
+  static ShaderObjectCache cache;
+  return cache;
+}
+
+unsigned int ShaderObjectCache::acquire(GLenum type, std::string_view code)
+{
+  return acquire(type, code, key(type, code));
+}
+
+unsigned int ShaderObjectCache::acquire(
+  GLenum type,
+  std::string_view code,
+  std::uint64_t key)
+{
+  // Held while compiling, so that a stage is only submitted once.
+  std::lock_guard<std::mutex> lock(mutex);
+  auto cached = shaders.find(key);
+  if (cached != shaders.end())
+  {
+    entries[cached->second].users++;
+    return cached->second;
+  }
+
+  const char* source = code.data();
+  int length = int(code.size());
+
+  unsigned int shader = glCreateShader(type);
+  glShaderSource(shader, 1, &source, &length);
+  glCompileShader(shader);
+
+  shaders[key] = shader;
+  entries[shader] = { key, 1 };
+  return shader;
+}
+
+std::uint64_t ShaderObjectCache::key(GLenum type, std::string_view code)
+{
+  return hashContent(code, hashField(
+    std::string_view(reinterpret_cast<const char*>(&type), sizeof(type)),
+    FNV_OFFSET_BASIS_64));
+}
+
+void ShaderObjectCache::release(unsigned int shader)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  auto entry = entries.find(shader);
+  if (entry != entries.end() && entry->second.users > 0)
+  {
+    entry->second.users--;
+  }
+}
+
+void ShaderObjectCache::trim()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto entry = entries.begin(); entry != entries.end();)
+  {
+    if (entry->second.users > 0)
+    {
+      ++entry;
+      continue;
+    }
+
+    glDeleteShader(entry->first);
+    shaders.erase(entry->second.key);
+    entry = entries.erase(entry);
+  }
+}
+
+void ShaderObjectCache::contextChanged()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  shaders.clear();
+  entries.clear();
+}
+
+std::size_t ShaderObjectCache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return entries.size();
+}
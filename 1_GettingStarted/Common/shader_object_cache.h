@@ -0,0 +1,84 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_OBJECT_CACHE_H__
+#define __OPENGL_TUTORIAL_SHADER_OBJECT_CACHE_H__
+
+#include "glad/glad.h"
+#include "hash.h"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+// Compiled shader objects shared between programs.
+// Stages are identified by their type and a hash of their source, so a stage
+// used by several programs is only compiled once. Each acquire() must be
+// matched by a release() once the program using the stage has linked. Stages
+// which are no longer in use are kept until trim() is called, so that
+// programs created one after another can still share them.
+//
+// The IDs belong to the context the stages were compiled on, so the cache
+// must be told when a new one is made. Threads whose contexts share objects
+// with it may use the cache at the same time.
+class ShaderObjectCache
+{
+public:
+  // The cache shared by every program creation path in the process.
+  static ShaderObjectCache& instance();
+
+  // Get a shader object for the source, submitting it for compilation if it
+  // is not in the cache. The compile status is not checked.
+  unsigned int acquire(GLenum type, std::string_view code);
+
+  // The same, with the key already computed by key().
+  unsigned int acquire(GLenum type, std::string_view code, std::uint64_t key);
+
+  // Identifies a stage by its type and source. Needs no GL context.
+  static std::uint64_t key(GLenum type, std::string_view code);
+
+  // Stop using a shader object returned by acquire().
+  void release(unsigned int shader);
+
+  // Delete the shader objects which are not in use. Call this once loading
+  // is done.
+  void trim();
+
+  // Forget every shader object, when a new context is made. They belonged
+  // to the old context, and went with it.
+  void contextChanged();
+
+  // The number of shader objects currently held.
+  std::size_t size() const;
+
+private:
+  struct Entry
+  {
+    std::uint64_t key;
+    int users;
+  };
+
+  mutable std::mutex mutex;
+
+  // Shader object IDs keyed by type and source hash, and the reverse.
+  std::unordered_map<std::uint64_t, unsigned int> shaders;
+  std::map<unsigned int, Entry> entries;
+};
+
+// A stage acquired from the cache for as long as it is in scope, so that it
+// is released however the code using it returns.
+class CachedStage
+{
+public:
+  CachedStage(GLenum type, std::string_view code) :
+    shader(ShaderObjectCache::instance().acquire(type, code)) {}
+  ~CachedStage() { ShaderObjectCache::instance().release(shader); }
+
+  CachedStage(const CachedStage&) = delete;
+  CachedStage& operator=(const CachedStage&) = delete;
+
+  unsigned int id() const { return shader; }
+
+private:
+  unsigned int shader;
+};
+
+#endif // __OPENGL_TUTORIAL_SHADER_OBJECT_CACHE_H__
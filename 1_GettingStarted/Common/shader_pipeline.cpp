@@ -0,0 +1,187 @@
+#include "shader_pipeline.h"
+
+ShaderPipeline::ShaderPipeline(unsigned workers) :
+  cacheEnabled(ProgramCache::instance().enabled()),
+  driverKey(cacheEnabled ? ProgramCache::instance().driverKey() : 0)
+{
+  if (workers == 0)
+  {
+    workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  for (unsigned i = 0; i < workers; i++)
+  {
+    threads.emplace_back(&ShaderPipeline::work, this);
+  }
+}
+
+ShaderPipeline::~ShaderPipeline()
+{
+  {
+    std::lock_guard<std::mutex> lock(jobMutex);
+    stopping = true;
+  }
+
+  jobReady.notify_all();
+  for (std::thread& thread : threads) thread.join();
+
+  Prepared* node = prepared.exchange(nullptr, std::memory_order_acquire);
+  while (node != nullptr)
+  {
+    Prepared* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+std::size_t ShaderPipeline::submit(ShaderFiles files, ShaderDefines defines)
+{
+  const std::size_t index = pending.size();
+  pending.emplace_back();
+  {
+    std::lock_guard<std::mutex> lock(jobMutex);
+    jobs.push_back({ index, std::move(files), std::move(defines) });
+  }
+
+  jobReady.notify_one();
+  return index;
+}
+
+std::size_t ShaderPipeline::pump()
+{
+  Prepared* node = prepared.exchange(nullptr, std::memory_order_acquire);
+
+  // The stack is newest first, so reverse it to submit in arrival order.
+  Prepared* ordered = nullptr;
+  while (node != nullptr)
+  {
+    Prepared* next = node->next;
+    node->next = ordered;
+    ordered = node;
+    node = next;
+  }
+
+  std::size_t count = 0;
+  while (ordered != nullptr)
+  {
+    Prepared* next = ordered->next;
+    if (ordered->failed)
+    {
+      ShaderBuildRecord build;
+      build.name = ordered->program.name;
+      ShaderTelemetry::instance().recordFailure(
+        std::move(build), "The sources could not be read");
+      failed = true;
+    }
+    else
+    {
+      pending[ordered->index].emplace(ordered->program);
+    }
+
+    submitted++;
+    count++;
+    delete ordered;
+    ordered = next;
+  }
+
+  return count;
+}
+
+std::vector<Shader> ShaderPipeline::finish()
+{
+  while (submitted < pending.size())
+  {
+    if (pump() > 0) continue;
+
+    std::unique_lock<std::mutex> lock(jobMutex);
+    preparedReady.wait(lock, [this]
+    {
+      return prepared.load(std::memory_order_relaxed) != nullptr;
+    });
+  }
+
+  std::vector<std::optional<PendingShader>> built;
+  built.swap(pending);
+
+  submitted = 0;
+  if (failed)
+  {
+    failed = false;
+    std::cout << "Shader pipeline: some sources could not be prepared"
+              << std::endl;
+    throw std::exception();
+  }
+
+  std::vector<Shader> shaders;
+  shaders.reserve(built.size());
+  for (std::optional<PendingShader>& program : built)
+  {
+    shaders.push_back(program->get());
+  }
+
+  return shaders;
+}
+
+void ShaderPipeline::work()
+{
+  ShaderPreprocessor preprocessor;
+  while (true)
+  {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(jobMutex);
+      jobReady.wait(lock, [this] { return stopping || !jobs.empty(); });
+      if (jobs.empty()) return;
+
+      job = std::move(jobs.front());
+      jobs.pop_front();
+    }
+
+    Prepared* node = new Prepared{ nullptr, job.index, false, {} };
+    try
+    {
+      ShaderTimer timer;
+      PreparedProgram& program = node->program;
+      program.name = job.files.vertexPath + " + " + job.files.fragmentPath;
+      program.vertexCode =
+        preprocessor.process(job.files.vertexPath, job.defines);
+      program.fragmentCode =
+        preprocessor.process(job.files.fragmentPath, job.defines);
+      program.readMs = timer.lap();
+
+      program.vertexKey =
+        ShaderObjectCache::key(GL_VERTEX_SHADER, program.vertexCode);
+      program.fragmentKey =
+        ShaderObjectCache::key(GL_FRAGMENT_SHADER, program.fragmentCode);
+      if (cacheEnabled)
+      {
+        program.cacheKey = ProgramCache::key(
+          driverKey, program.vertexCode, program.fragmentCode);
+      }
+    }
+    catch (const std::exception&)
+    {
+      // The preprocessor has already printed the reason.
+      node->failed = true;
+    }
+
+    push(node);
+
+    // Taking the lock makes sure finish() is either not yet waiting or will
+    // see the notification.
+    {
+      std::lock_guard<std::mutex> lock(jobMutex);
+    }
+
+    preparedReady.notify_one();
+  }
+}
+
+void ShaderPipeline::push(Prepared* node)
+{
+  node->next = prepared.load(std::memory_order_relaxed);
+  while (!prepared.compare_exchange_weak(
+    node->next, node, std::memory_order_release, std::memory_order_relaxed))
+  {
+  }
+}
@@ -0,0 +1,92 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_PIPELINE_H__
+#define __OPENGL_TUTORIAL_SHADER_PIPELINE_H__
+
+#include "glad/glad.h"
+#include "program_cache.h"
+#include "shader.h"
+#include "shader_object_cache.h"
+#include "shader_preprocessor.h"
+#include "shader_telemetry.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// Builds many programs, with the file I/O, preprocessing and hashing done on
+// worker threads. The thread which owns the GL context only takes the
+// prepared sources off a lock-free queue and hands them to the driver, so
+// reading the next sources overlaps with compiling the previous ones.
+// The pipeline itself must only be used on the context thread.
+class ShaderPipeline
+{
+public:
+  // Start the workers (one per hardware thread if workers is 0).
+  explicit ShaderPipeline(unsigned workers = 0);
+  ~ShaderPipeline();
+
+  ShaderPipeline(const ShaderPipeline&) = delete;
+  ShaderPipeline& operator=(const ShaderPipeline&) = delete;
+
+  // Queue a program to be built. Returns its index in the result of finish().
+  std::size_t submit(ShaderFiles files, ShaderDefines defines = {});
+
+  // Hand every program the workers have prepared so far to the driver,
+  // without waiting for anything. Returns the number of programs submitted.
+  std::size_t pump();
+
+  // Wait for every queued program and return them in the order they were
+  // queued. Prints a message and throws if any of them fails to build.
+  std::vector<Shader> finish();
+
+private:
+  struct Job
+  {
+    std::size_t index;
+    ShaderFiles files;
+    ShaderDefines defines;
+  };
+
+  // A prepared program on its way to the context thread.
+  struct Prepared
+  {
+    Prepared* next;
+    std::size_t index;
+    bool failed;
+    PreparedProgram program;
+  };
+
+  // Asked on the context thread, as they need the driver. The workers only
+  // hash the sources for the cache when it is enabled.
+  bool cacheEnabled;
+  std::uint64_t driverKey;
+
+  std::vector<std::thread> threads;
+
+  // Jobs waiting for a worker.
+  std::mutex jobMutex;
+  std::condition_variable jobReady;
+  std::deque<Job> jobs;
+  bool stopping = false;
+
+  // Workers push prepared programs onto this stack, and pump() takes all of
+  // them at once, so neither side ever waits for the other. Only finish()
+  // sleeps on preparedReady when there is nothing else to do.
+  std::atomic<Prepared*> prepared{ nullptr };
+  std::condition_variable preparedReady;
+
+  // Indexed by the job index. A program which failed to prepare is left
+  // empty and recorded in failed.
+  std::vector<std::optional<PendingShader>> pending;
+  std::size_t submitted = 0;
+  bool failed = false;
+
+  void work();
+  void push(Prepared* node);
+};
+
+#endif // __OPENGL_TUTORIAL_SHADER_PIPELINE_H__
@@ -0,0 +1,222 @@
+#include "shader_preprocessor.h"
+
+std::string ShaderPreprocessor::process(
+  const std::string& path,
+  const ShaderDefines& defines)
+{
+  fileNames.clear();
+  includeStack.clear();
+
+  std::string code;
+  expand(path, code);
+  return addDefines(std::move(code), defines);
+}
+
+std::string ShaderPreprocessor::addDefines(
+  std::string code,
+  const ShaderDefines& defines)
+{
+  // Only define what the shader can see, so that irrelevant defines do not
+  // produce distinct programs.
+  std::string prologue;
+  for (const ShaderDefine& define : defines)
+  {
+    if (!references(code, define.name)) continue;
+    prologue += "#define " + define.name;
+    if (!define.value.empty()) prologue += " " + define.value;
+    prologue += "\n";
+  }
+
+  if (prologue.empty()) return code;
+
+  // The #version directive has to stay in front of everything else.
+  const std::size_t insertAt = versionEnd(code);
+  const int nextLine =
+    int(std::count(code.begin(), code.begin() + insertAt, '\n')) + 1;
+
+  prologue += "#line " + std::to_string(nextLine) + " 0\n";
+  code.insert(insertAt, prologue);
+  return code;
+}
+
+std::size_t ShaderPreprocessor::versionEnd(std::string_view code)
+{
+  std::size_t at = 0;
+  while (at < code.size())
+  {
+    at = code.find_first_not_of(" \t\r\n", at);
+    if (at == std::string_view::npos) return 0;
+
+    if (code.compare(at, 2, "//") == 0)
+    {
+      at = code.find('\n', at);
+      continue;
+    }
+
+    if (code.compare(at, 2, "/*") == 0)
+    {
+      at = code.find("*/", at + 2);
+      if (at == std::string_view::npos) return 0;
+      at += 2;
+      continue;
+    }
+
+    // Anything else ends the search: either this is the directive, or the
+    // shader has none and the defines can go first.
+    if (code[at] != '#') return 0;
+    std::size_t directive = code.find_first_not_of(" \t", at + 1);
+    if (directive == std::string_view::npos
+     || code.compare(directive, 7, "version") != 0)
+    {
+      return 0;
+    }
+
+    std::size_t end = code.find('\n', directive);
+    return end == std::string_view::npos ? code.size() : end + 1;
+  }
+
+  return 0;
+}
+
+void ShaderPreprocessor::expand(const std::string& path, std::string& output)
+{
+  if (std::find(includeStack.begin(), includeStack.end(), path)
+    != includeStack.end())
+  {
+    std::cout << "Shader file includes itself: " << path << std::endl;
+    throw std::exception();
+  }
+
+  // Every file is included at most once.
+  if (std::find(fileNames.begin(), fileNames.end(), path) != fileNames.end())
+  {
+    return;
+  }
+
+  const int fileIndex = int(fileNames.size());
+  fileNames.push_back(path);
+  includeStack.push_back(path);
+
+  ShaderSource source =
+    copyFiles ? ShaderSource::copy(path) : ShaderSource(path);
+  std::string_view code = source.view();
+
+  int lineNumber = 0;
+  while (!code.empty())
+  {
+    std::size_t end = code.find('\n');
+    std::string_view line = code.substr(0, end);
+    code.remove_prefix(end == std::string_view::npos ? code.size() : end + 1);
+    lineNumber++;
+
+    std::size_t start = line.find_first_not_of(" \t");
+    if (start == std::string_view::npos
+     || line.compare(start, 8, "#include") != 0)
+    {
+      output.append(line.data(), line.size());
+      output += '\n';
+      continue;
+    }
+
+    std::size_t open = line.find('"', start + 8);
+    std::size_t close = open == std::string_view::npos
+      ? open : line.find('"', open + 1);
+    if (close == std::string_view::npos)
+    {
+      std::cout << path << ":" << lineNumber << ": malformed #include"
+                << std::endl;
+      throw std::exception();
+    }
+
+    std::string included(line.substr(open + 1, close - open - 1));
+    if (included.empty() || included[0] != '/')
+    {
+      included = directoryOf(path) + included;
+    }
+
+    output += "#line 1 " + std::to_string(fileNames.size()) + "\n";
+    expand(included, output);
+    output += "#line " + std::to_string(lineNumber + 1) + " "
+      + std::to_string(fileIndex) + "\n";
+  }
+
+  includeStack.pop_back();
+}
+
+std::string ShaderPreprocessor::directoryOf(const std::string& path)
+{
+  std::size_t slash = path.find_last_of('/');
+  return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+}
+
+bool ShaderPreprocessor::references(std::string_view code, std::string_view name)
+{
+  auto isIdentifier = [](char c)
+  {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+  };
+
+  for (std::size_t at = code.find(name); at != std::string_view::npos;
+    at = code.find(name, at + 1))
+  {
+    std::size_t end = at + name.size();
+    if ((at == 0 || !isIdentifier(code[at - 1]))
+     && (end == code.size() || !isIdentifier(code[end])))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+ShaderVariants::ShaderVariants(std::string vertexPath, std::string fragmentPath) :
+  vertexPath(std::move(vertexPath)),
+  fragmentPath(std::move(fragmentPath))
+{
+}
+
+Shader& ShaderVariants::get(const ShaderDefines& defines)
+{
+  const std::string key = variantKey(defines);
+  auto variant = variants.find(key);
+  if (variant != variants.end()) return *variant->second;
+
+  const std::string vertexCode = preprocessor.process(vertexPath, defines);
+  const std::string fragmentCode = preprocessor.process(fragmentPath, defines);
+
+  const std::uint64_t hash =
+    hashField(fragmentCode, hashField(vertexCode, FNV_OFFSET_BASIS_64));
+
+  std::unique_ptr<Shader>& program = programs[hash];
+  if (!program)
+  {
+    try
+    {
+      program = std::make_unique<Shader>(
+        PendingShader(vertexCode, fragmentCode).get());
+    }
+    catch (...)
+    {
+      programs.erase(hash);
+      throw;
+    }
+  }
+
+  variants[key] = program.get();
+  return *program;
+}
+
+std::string ShaderVariants::variantKey(ShaderDefines defines)
+{
+  std::sort(defines.begin(), defines.end(),
+    [](const ShaderDefine& a, const ShaderDefine& b) { return a.name < b.name; });
+
+  std::string key;
+  for (const ShaderDefine& define : defines)
+  {
+    key += define.name + "=" + define.value + "\n";
+  }
+
+  return key;
+}
@@ -0,0 +1,97 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_PREPROCESSOR_H__
+#define __OPENGL_TUTORIAL_SHADER_PREPROCESSOR_H__
+
+#include "hash.h"
+#include "shader.h"
+#include "shader_source.h"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A macro to define in front of a shader, e.g. { "UPSIDE_DOWN", "" }.
+struct ShaderDefine
+{
+  std::string name;
+  std::string value;
+};
+
+using ShaderDefines = std::vector<ShaderDefine>;
+
+// Expands a shader file before it is handed to the driver.
+// #include "file" directives are replaced by the named file (relative to the
+// including file, and only once per shader), and the given defines are
+// inserted after the #version line. #line directives keep the driver's error
+// messages pointing at the original files: the source string number is the
+// index of the file in files().
+class ShaderPreprocessor
+{
+public:
+  // Files are mapped (see ShaderSource) unless copyFiles is set, which
+  // reads them into memory instead, for files which may be rewritten at any
+  // moment.
+  explicit ShaderPreprocessor(bool copyFiles = false) :
+    copyFiles(copyFiles)
+  {
+  }
+
+  // Prints a message and throws if a file cannot be read or includes itself.
+  std::string process(const std::string& path, const ShaderDefines& defines);
+
+  // Insert the defines which the code refers to after its #version line,
+  // followed by a #line directive for source string 0. #include directives
+  // are left alone.
+  static std::string addDefines(std::string code, const ShaderDefines& defines);
+
+  // The files read by the last call to process(), in source string order.
+  const std::vector<std::string>& files() const { return fileNames; }
+
+private:
+  bool copyFiles;
+  std::vector<std::string> fileNames;
+  std::vector<std::string> includeStack;
+
+  void expand(const std::string& path, std::string& output);
+
+  // The offset just past the #version line, skipping any comments and
+  // blank lines in front of it (0 if there is none).
+  static std::size_t versionEnd(std::string_view code);
+
+  static std::string directoryOf(const std::string& path);
+  static bool references(std::string_view code, std::string_view name);
+};
+
+// All the variants of one vertex/fragment shader pair.
+// Each set of defines is preprocessed and compiled the first time it is asked
+// for. Defines that the shader never mentions are dropped, so variants which
+// preprocess to the same code share a single program.
+class ShaderVariants
+{
+public:
+  ShaderVariants(std::string vertexPath, std::string fragmentPath);
+
+  // Get the program built with the given defines.
+  Shader& get(const ShaderDefines& defines = {});
+
+  // The number of distinct programs compiled so far.
+  std::size_t programCount() const { return programs.size(); }
+
+private:
+  std::string vertexPath;
+  std::string fragmentPath;
+  ShaderPreprocessor preprocessor;
+
+  // Keyed by the define set, in canonical order.
+  std::map<std::string, Shader*> variants;
+
+  // Keyed by a hash of the preprocessed sources.
+  std::map<std::uint64_t, std::unique_ptr<Shader>> programs;
+
+  static std::string variantKey(ShaderDefines defines);
+};
+
+#endif // __OPENGL_TUTORIAL_SHADER_PREPROCESSOR_H__
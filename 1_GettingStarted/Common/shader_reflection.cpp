@@ -0,0 +1,12 @@
+#include "shader_reflection.h"
+
+std140::Layout ReflectedBlock::layout() const
+{
+  std140::Layout result;
+  for (std::size_t i = 0; i < memberCount; i++)
+  {
+    result.add(std::string(members[i].name), members[i].type, members[i].count);
+  }
+
+  return result;
+}
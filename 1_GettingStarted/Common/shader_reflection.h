@@ -0,0 +1,58 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_REFLECTION_H__
+#define __OPENGL_TUTORIAL_SHADER_REFLECTION_H__
+
+#include "glad/glad.h"
+#include "std140.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// The descriptions of shader interfaces which reflect_shaders() in CMake
+// generates from GLSL sources at build time.
+
+// A uniform declared outside any block.
+struct ReflectedUniform
+{
+  std::string_view name;
+
+  // hashName(name), for looking the uniform up in a UniformTable.
+  std::uint32_t hash;
+
+  GLenum type;
+
+  // The array length, or 0 for a single value.
+  unsigned count;
+};
+
+// A vertex shader input.
+struct ReflectedAttribute
+{
+  std::string_view name;
+  GLenum type;
+
+  // From the layout qualifier, or -1 if the linker assigns it.
+  int location;
+};
+
+// A member of a std140 uniform block.
+struct ReflectedBlockMember
+{
+  std::string_view name;
+  std140::Type type;
+  unsigned count;
+  unsigned offset;
+};
+
+struct ReflectedBlock
+{
+  std::string_view name;
+  unsigned size;
+  const ReflectedBlockMember* members;
+  std::size_t memberCount;
+
+  // The layout to create a UniformBlock with.
+  std140::Layout layout() const;
+};
+
+#endif // __OPENGL_TUTORIAL_SHADER_REFLECTION_H__
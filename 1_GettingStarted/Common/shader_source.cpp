@@ -0,0 +1,148 @@
+#include "shader_source.h"
+
+ShaderSource::ShaderSource(const std::string& path)
+{
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  struct stat info;
+  if (fd < 0 || fstat(fd, &info) < 0)
+  {
+    int error = errno;
+    if (fd >= 0) close(fd);
+    std::cout << "Failed to read shader file " << path << ": "
+              << std::strerror(error) << std::endl;
+    throw std::exception();
+  }
+
+  // An empty file cannot be mapped, but it is still a (useless) source.
+  if (info.st_size > 0)
+  {
+    void* memory = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (memory == MAP_FAILED)
+    {
+      int error = errno;
+      close(fd);
+      std::cout << "Failed to map shader file " << path << ": "
+                << std::strerror(error) << std::endl;
+      throw std::exception();
+    }
+
+    code = static_cast<const char*>(memory);
+    size = std::size_t(info.st_size);
+    mapped = true;
+  }
+
+  // The mapping stays valid after the descriptor is closed.
+  close(fd);
+}
+
+ShaderSource ShaderSource::copy(const std::string& path)
+{
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    int error = errno;
+    std::cout << "Failed to read shader file " << path << ": "
+              << std::strerror(error) << std::endl;
+    throw std::exception();
+  }
+
+  // Read until the end rather than trusting the size, which may change
+  // while the file is being saved.
+  std::string contents;
+  char buffer[4096];
+  while (true)
+  {
+    ssize_t length = read(fd, buffer, sizeof(buffer));
+    if (length == 0) break;
+    if (length < 0)
+    {
+      if (errno == EINTR) continue;
+
+      int error = errno;
+      close(fd);
+      std::cout << "Failed to read shader file " << path << ": "
+                << std::strerror(error) << std::endl;
+      throw std::exception();
+    }
+
+    contents.append(buffer, std::size_t(length));
+  }
+
+  close(fd);
+
+  ShaderSource source;
+  if (!contents.empty())
+  {
+    source.copied = std::make_unique<char[]>(contents.size());
+    std::memcpy(source.copied.get(), contents.data(), contents.size());
+    source.code = source.copied.get();
+    source.size = contents.size();
+  }
+
+  return source;
+}
+
+ShaderSource::~ShaderSource()
+{
+  unmap();
+}
+
+ShaderSource::ShaderSource(ShaderSource&& other) noexcept :
+  code(other.code),
+  size(other.size),
+  mapped(other.mapped),
+  copied(std::move(other.copied))
+{
+  other.code = "";
+  other.size = 0;
+  other.mapped = false;
+}
+
+ShaderSource& ShaderSource::operator=(ShaderSource&& other) noexcept
+{
+  if (this != &other)
+  {
+    unmap();
+    code = other.code;
+    size = other.size;
+    mapped = other.mapped;
+    copied = std::move(other.copied);
+    other.code = "";
+    other.size = 0;
+    other.mapped = false;
+  }
+
+  return *this;
+}
+
+void ShaderSource::unmap()
+{
+  if (mapped)
+  {
+    munmap(const_cast<char*>(code), size);
+    code = "";
+    size = 0;
+    mapped = false;
+  }
+
+  copied.reset();
+}
+
+std::vector<ShaderSource> loadShaderSources(
+  const std::vector<std::string>& paths)
+{
+  std::vector<ShaderSource> sources;
+  sources.reserve(paths.size());
+  for (const std::string& path : paths)
+  {
+    sources.emplace_back(path);
+
+    const ShaderSource& source = sources.back();
+    if (source.length() > 0)
+    {
+      madvise(const_cast<char*>(source.data()), source.length(), MADV_WILLNEED);
+    }
+  }
+
+  return sources;
+}
@@ -0,0 +1,61 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_SOURCE_H__
+#define __OPENGL_TUTORIAL_SHADER_SOURCE_H__
+
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// A shader source file mapped read-only into memory.
+// The contents can be handed straight to glShaderSource as a pointer and
+// length pair, so the file is never copied.
+class ShaderSource
+{
+public:
+  // Map the file (prints a message and throws if it cannot be read).
+  explicit ShaderSource(const std::string& path);
+
+  // Read the file into memory of its own instead (prints a message and
+  // throws if it cannot be read). For files which may be rewritten while
+  // they are in use, such as those ShaderWatcher reloads: truncating a
+  // mapped file kills the process with SIGBUS when the lost pages are read.
+  static ShaderSource copy(const std::string& path);
+  ~ShaderSource();
+
+  ShaderSource(ShaderSource&& other) noexcept;
+  ShaderSource& operator=(ShaderSource&& other) noexcept;
+  ShaderSource(const ShaderSource&) = delete;
+  ShaderSource& operator=(const ShaderSource&) = delete;
+
+  const char* data() const { return code; }
+  int length() const { return int(size); }
+  std::string_view view() const { return std::string_view(code, size); }
+
+private:
+  const char* code = "";
+  std::size_t size = 0;
+  bool mapped = false;
+
+  // What code points at, for a copied file.
+  std::unique_ptr<char[]> copied;
+
+  ShaderSource() = default;
+
+  void unmap();
+};
+
+// Map a batch of shader files. The kernel is asked to read all of them ahead
+// at once so that their I/O overlaps instead of happening one file at a time.
+std::vector<ShaderSource> loadShaderSources(
+  const std::vector<std::string>& paths);
+
+#endif // __OPENGL_TUTORIAL_SHADER_SOURCE_H__
@@ -0,0 +1,143 @@
+#include "shader_telemetry.h"
+
+double ShaderTimer::lap()
+{
+  const auto now = std::chrono::steady_clock::now();
+  const double elapsed =
+    std::chrono::duration<double, std::milli>(now - start).count();
+
+  start = now;
+  return elapsed;
+}
+
+ShaderTelemetry::ShaderTelemetry(std::string reportPath) :
+  reportPath(std::move(reportPath))
+{
+}
+
+ShaderTelemetry::~ShaderTelemetry()
+{
+  if (reportPath.empty()) return;
+
+  std::ofstream file(reportPath);
+  if (!file)
+  {
+    std::cout << "Failed to write shader report " << reportPath << std::endl;
+    return;
+  }
+
+  writeJson(file);
+}
+
+ShaderTelemetry& ShaderTelemetry::instance()
+{
+  static ShaderTelemetry telemetry([]
+  {
+    const char* path = std::getenv("LEARNOGL_SHADER_REPORT");
+    return std::string(path ? path : "");
+  }());
+
+  return telemetry;
+}
+
+void ShaderTelemetry::record(ShaderBuildRecord build)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  builds.push_back(std::move(build));
+}
+
+void ShaderTelemetry::recordFailure(ShaderBuildRecord build, std::string error)
+{
+  build.failed = true;
+  build.error = std::move(error);
+  record(std::move(build));
+}
+
+void ShaderTelemetry::recordWarmup(std::string name, double ms)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  warmups.emplace_back(std::move(name), ms);
+}
+
+std::vector<ShaderBuildRecord> ShaderTelemetry::records() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return builds;
+}
+
+void ShaderTelemetry::writeJson(std::ostream& out) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  out << "{\n  \"programs\": [";
+  for (std::size_t i = 0; i < builds.size(); i++)
+  {
+    const ShaderBuildRecord& build = builds[i];
+
+    char times[256];
+    std::snprintf(times, sizeof(times),
+      "\"readMs\": %.3f, \"vertexCompileMs\": %.3f, "
+      "\"fragmentCompileMs\": %.3f, \"linkMs\": %.3f",
+      build.readMs,
+      build.vertexCompileMs,
+      build.fragmentCompileMs,
+      build.linkMs);
+
+    out << (i == 0 ? "\n" : ",\n") << "    { \"name\": ";
+    writeString(out, build.name);
+    out << ", \"sourceBytes\": " << build.sourceBytes
+        << ", " << times
+        << ", \"cacheHit\": " << (build.cacheHit ? "true" : "false")
+        << ", \"failed\": " << (build.failed ? "true" : "false");
+
+    if (build.failed)
+    {
+      out << ", \"error\": ";
+      writeString(out, build.error);
+    }
+
+    out << " }";
+  }
+
+  out << "\n  ],\n  \"warmups\": [";
+  for (std::size_t i = 0; i < warmups.size(); i++)
+  {
+    char ms[32];
+    std::snprintf(ms, sizeof(ms), "%.3f", warmups[i].second);
+
+    out << (i == 0 ? "\n" : ",\n") << "    { \"name\": ";
+    writeString(out, warmups[i].first);
+    out << ", \"ms\": " << ms << " }";
+  }
+
+  out << "\n  ]\n}\n";
+}
+
+void ShaderTelemetry::writeString(std::ostream& out, std::string_view text)
+{
+  out << '"';
+  for (char c : text)
+  {
+    switch (c)
+    {
+      case '"': out << "\\\""; break;
+      case '\\': out << "\\\\"; break;
+      case '\n': out << "\\n"; break;
+      case '\r': out << "\\r"; break;
+      case '\t': out << "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          char escaped[8];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          out << escaped;
+        }
+        else
+        {
+          out << c;
+        }
+    }
+  }
+
+  out << '"';
+}
@@ -0,0 +1,89 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_TELEMETRY_H__
+#define __OPENGL_TUTORIAL_SHADER_TELEMETRY_H__
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// What happened while building one program. Times are in milliseconds.
+// Compile and link times include the time spent waiting for the driver, so
+// stages compiled in parallel may overlap, and a stage shared with an earlier
+// program costs (almost) nothing.
+struct ShaderBuildRecord
+{
+  // The source files, or "<memory>" for sources which were not read from
+  // files.
+  std::string name;
+  std::size_t sourceBytes = 0;
+
+  double readMs = 0;
+  double vertexCompileMs = 0;
+  double fragmentCompileMs = 0;
+  double linkMs = 0;
+
+  // Restored from the program binary cache (nothing was compiled).
+  bool cacheHit = false;
+
+  // The driver's message if the build failed.
+  bool failed = false;
+  std::string error;
+};
+
+// Measures the time between calls.
+class ShaderTimer
+{
+public:
+  ShaderTimer() : start(std::chrono::steady_clock::now()) {}
+
+  // The milliseconds since the timer was created or last lapped, restarting
+  // the timer.
+  double lap();
+
+private:
+  std::chrono::steady_clock::time_point start;
+};
+
+// Collects a record for every program built in the process.
+// If the LEARNOGL_SHADER_REPORT environment variable names a file, the
+// records are written to it as JSON when the process exits.
+class ShaderTelemetry
+{
+public:
+  explicit ShaderTelemetry(std::string reportPath);
+  ~ShaderTelemetry();
+
+  // The telemetry shared by every program creation path in the process.
+  static ShaderTelemetry& instance();
+
+  void record(ShaderBuildRecord build);
+
+  // Record a build which failed with the given message.
+  void recordFailure(ShaderBuildRecord build, std::string error);
+
+  // Record the time taken by a program's first draws (see ShaderWarmup).
+  void recordWarmup(std::string name, double ms);
+
+  // A copy of the records so far, in the order the builds finished.
+  std::vector<ShaderBuildRecord> records() const;
+
+  void writeJson(std::ostream& out) const;
+
+private:
+  std::string reportPath;
+
+  // Programs can be built on more than one thread.
+  mutable std::mutex mutex;
+  std::vector<ShaderBuildRecord> builds;
+  std::vector<std::pair<std::string, double>> warmups;
+
+  static void writeString(std::ostream& out, std::string_view text);
+};
+
+#endif // __OPENGL_TUTORIAL_SHADER_TELEMETRY_H__
@@ -0,0 +1,102 @@
+#include "shader_warmup.h"
+
+void ShaderWarmup::add(
+  const Shader& shader,
+  VertexLayout layout,
+  std::string name)
+{
+  auto entry = std::find_if(entries.begin(), entries.end(),
+    [&](const Entry& existing) { return existing.shader == &shader; });
+
+  if (entry == entries.end())
+  {
+    if (name.empty()) name = "program " + std::to_string(shader.ID);
+    entries.push_back({ &shader, std::move(name), {} });
+    entry = entries.end() - 1;
+  }
+
+  entry->layouts.push_back(std::move(layout));
+}
+
+std::vector<WarmupTiming> ShaderWarmup::run()
+{
+  std::vector<WarmupTiming> timings;
+  if (entries.empty()) return timings;
+
+  // Remember what is bound, to put it back at the end.
+  int drawFramebuffer, readFramebuffer, renderbufferBinding;
+  int program, vertexArray, arrayBuffer, viewport[4];
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+  glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+  glGetIntegerv(GL_RENDERBUFFER_BINDING, &renderbufferBinding);
+  glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+  glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vertexArray);
+  glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &arrayBuffer);
+  glGetIntegerv(GL_VIEWPORT, viewport);
+
+  unsigned int target, renderbuffer;
+  glGenRenderbuffers(1, &renderbuffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 1, 1);
+  glGenFramebuffers(1, &target);
+  glBindFramebuffer(GL_FRAMEBUFFER, target);
+  glFramebufferRenderbuffer(
+    GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+  glViewport(0, 0, 1, 1);
+
+  // A triangle's worth of zeroes is enough for any layout.
+  unsigned int stride = 0;
+  for (const Entry& entry : entries)
+  {
+    for (const VertexLayout& layout : entry.layouts)
+    {
+      stride = std::max(stride, layout.stride);
+    }
+  }
+
+  const std::vector<unsigned char> zeroes(3 * std::max(stride, 64u), 0);
+  unsigned int vertexBuffer;
+  glGenBuffers(1, &vertexBuffer);
+  glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+  glBufferData(
+    GL_ARRAY_BUFFER, zeroes.size(), zeroes.data(), GL_STATIC_DRAW);
+
+  // Make sure the setup is not charged to the first program.
+  glFinish();
+
+  {
+    // The vertex arrays are only needed here.
+    VertexArrayCache arrays;
+    for (const Entry& entry : entries)
+    {
+      ShaderTimer timer;
+      glUseProgram(entry.shader->ID);
+      for (const VertexLayout& layout : entry.layouts)
+      {
+        arrays.get(*entry.shader, layout, vertexBuffer);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+      }
+
+      glFinish();
+      timings.push_back({
+        entry.name, entry.shader->ID, entry.layouts.size(), timer.lap() });
+
+      ShaderTelemetry::instance().recordWarmup(entry.name, timings.back().ms);
+    }
+  }
+
+  glDeleteBuffers(1, &vertexBuffer);
+  glDeleteFramebuffers(1, &target);
+  glDeleteRenderbuffers(1, &renderbuffer);
+
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFramebuffer);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, renderbufferBinding);
+  glUseProgram(program);
+  Shader::setUniformTarget(program);
+  glBindVertexArray(vertexArray);
+  glBindBuffer(GL_ARRAY_BUFFER, arrayBuffer);
+  glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+  return timings;
+}
@@ -0,0 +1,50 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_WARMUP_H__
+#define __OPENGL_TUTORIAL_SHADER_WARMUP_H__
+
+#include "glad/glad.h"
+#include "shader.h"
+#include "shader_telemetry.h"
+#include "vertex_array.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// How long warming up one program took, in milliseconds.
+struct WarmupTiming
+{
+  std::string name;
+  unsigned int program;
+  std::size_t draws;
+  double ms;
+};
+
+// Draws with every program once while loading.
+// Many drivers only finish compiling a program (for the vertex formats it is
+// used with) when it is first drawn with, which would otherwise stall the
+// first frame that uses it. run() makes a tiny draw into a 1x1 offscreen
+// framebuffer for every (program, vertex layout) pair which was added, and
+// waits for each program in turn so that the time can be put down to it.
+class ShaderWarmup
+{
+public:
+  // Register a program with a vertex layout it will be drawn with. The
+  // shader must still exist when run() is called.
+  void add(const Shader& shader, VertexLayout layout, std::string name = "");
+
+  // Draw with every registered pair, and return the time taken by each
+  // program (also recorded in ShaderTelemetry). The GL bindings which are
+  // changed are restored afterwards.
+  std::vector<WarmupTiming> run();
+
+private:
+  struct Entry
+  {
+    const Shader* shader;
+    std::string name;
+    std::vector<VertexLayout> layouts;
+  };
+
+  std::vector<Entry> entries;
+};
+
+#endif // __OPENGL_TUTORIAL_SHADER_WARMUP_H__
@@ -0,0 +1,245 @@
+#include "shader_watcher.h"
+
+ShaderWatcher::ShaderWatcher() :
+  inotifyFd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)),
+  stopFd(eventfd(0, EFD_CLOEXEC))
+{
+  if (inotifyFd < 0 || stopFd < 0)
+  {
+    std::cout << "Failed to start shader watcher: "
+              << std::strerror(errno) << std::endl;
+    throw std::exception();
+  }
+
+  thread = std::thread(&ShaderWatcher::run, this);
+}
+
+ShaderWatcher::~ShaderWatcher()
+{
+  std::uint64_t one = 1;
+  if (write(stopFd, &one, sizeof(one)) < 0)
+  {
+    std::cout << "Failed to stop shader watcher" << std::endl;
+  }
+
+  thread.join();
+  close(inotifyFd);
+  close(stopFd);
+}
+
+void ShaderWatcher::watch(
+  Shader& shader,
+  const std::string& vertexPath,
+  const std::string& fragmentPath,
+  ShaderDefines defines)
+{
+  // The sources are only expanded to find the files they include.
+  std::string vertexCode, fragmentCode;
+  std::vector<std::string> files = preprocess(
+    vertexPath, fragmentPath, defines, vertexCode, fragmentCode);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const std::string& file : files)
+  {
+    if (!watchDirectory(file)) throw std::exception();
+  }
+
+  if (watched.empty()) owner = std::this_thread::get_id();
+  assert(owner == std::this_thread::get_id());
+
+  watched.push_back({
+    &shader, vertexPath, fragmentPath, std::move(defines), std::move(files),
+    nullptr });
+}
+
+int ShaderWatcher::update()
+{
+  // Only the owner thread touches the shaders and pending builds, so they
+  // are used below without the lock. The background thread only reads the
+  // paths and defines, and writes the file lists, under it. watch() can only
+  // add entries on this thread too, so the vector is not reallocated under
+  // the loop.
+  assert(watched.empty() || owner == std::this_thread::get_id());
+
+  std::vector<Changed> sources;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    sources.swap(changed);
+  }
+
+  // A newer edit replaces any build which is still in flight.
+  for (const Changed& source : sources)
+  {
+    watched[source.index].pending = std::make_unique<PendingShader>(
+      source.vertexCode, source.fragmentCode);
+  }
+
+  int replaced = 0;
+  for (Watched& entry : watched)
+  {
+    if (!entry.pending || !entry.pending->ready()) continue;
+
+    std::unique_ptr<PendingShader> pending = std::move(entry.pending);
+    try
+    {
+      *entry.shader = pending->get();
+      std::cout << "Reloaded " << entry.vertexPath << " and "
+                << entry.fragmentPath << std::endl;
+      replaced++;
+    }
+    catch (std::exception&)
+    {
+      std::cout << "Keeping the previous build of " << entry.vertexPath
+                << " and " << entry.fragmentPath << std::endl;
+    }
+  }
+
+  // The stages of the replaced programs are not needed any more.
+  if (replaced > 0)
+  {
+    ShaderObjectCache::instance().trim();
+  }
+
+  return replaced;
+}
+
+void ShaderWatcher::run()
+{
+  pollfd fds[2] = { { inotifyFd, POLLIN, 0 }, { stopFd, POLLIN, 0 } };
+  while (true)
+  {
+    if (poll(fds, 2, -1) < 0)
+    {
+      if (errno == EINTR) continue;
+      return;
+    }
+
+    if (fds[1].revents & POLLIN) return;
+
+    // A single save often produces several events, so drain them all before
+    // reading anything.
+    std::set<std::size_t> indices;
+    readEvents(indices);
+
+    for (std::size_t index : indices)
+    {
+      Changed source;
+      source.index = index;
+
+      std::string vertexPath, fragmentPath;
+      ShaderDefines defines;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        vertexPath = watched[index].vertexPath;
+        fragmentPath = watched[index].fragmentPath;
+        defines = watched[index].defines;
+      }
+
+      // The file may be mid-save; the next event will pick up the rest. It
+      // is read rather than mapped, so a truncation cannot fault this thread.
+      std::vector<std::string> files;
+      try
+      {
+        files = preprocess(
+          vertexPath, fragmentPath, defines,
+          source.vertexCode, source.fragmentCode);
+      }
+      catch (std::exception&)
+      {
+        continue;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+
+      // The edit may have included more files, which are watched from now on.
+      for (const std::string& file : files)
+      {
+        watchDirectory(file);
+      }
+
+      watched[index].files = std::move(files);
+      changed.push_back(std::move(source));
+    }
+  }
+}
+
+void ShaderWatcher::readEvents(std::set<std::size_t>& indices)
+{
+  alignas(inotify_event) char buffer[4096];
+  while (true)
+  {
+    ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+    if (length <= 0) return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (char* p = buffer; p < buffer + length;)
+    {
+      const inotify_event* event = reinterpret_cast<inotify_event*>(p);
+      p += sizeof(inotify_event) + event->len;
+
+      auto directory = directories.find(event->wd);
+      if (event->len == 0 || directory == directories.end()) continue;
+
+      const std::string name = event->name;
+      for (std::size_t i = 0; i < watched.size(); i++)
+      {
+        for (const std::string& path : watched[i].files)
+        {
+          auto [fileDirectory, fileName] = splitPath(path);
+          if (fileDirectory == directory->second && fileName == name)
+          {
+            indices.insert(i);
+          }
+        }
+      }
+    }
+  }
+}
+
+bool ShaderWatcher::watchDirectory(const std::string& path)
+{
+  // Watch the directory rather than the file: editors often save by writing
+  // a new file and renaming it over the old one.
+  const std::string directory = splitPath(path).first;
+  int wd = inotify_add_watch(
+    inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+
+  if (wd < 0)
+  {
+    std::cout << "Failed to watch " << directory << ": "
+              << std::strerror(errno) << std::endl;
+    return false;
+  }
+
+  directories[wd] = directory;
+  return true;
+}
+
+std::vector<std::string> ShaderWatcher::preprocess(
+  const std::string& vertexPath,
+  const std::string& fragmentPath,
+  const ShaderDefines& defines,
+  std::string& vertexCode,
+  std::string& fragmentCode)
+{
+  // Editors may truncate a file and write it again while it is being read,
+  // so it is copied rather than mapped.
+  ShaderPreprocessor preprocessor(true);
+  vertexCode = preprocessor.process(vertexPath, defines);
+  std::vector<std::string> files = preprocessor.files();
+
+  fragmentCode = preprocessor.process(fragmentPath, defines);
+  files.insert(
+    files.end(), preprocessor.files().begin(), preprocessor.files().end());
+  return files;
+}
+
+std::pair<std::string, std::string> ShaderWatcher::splitPath(
+  const std::string& path)
+{
+  std::size_t slash = path.find_last_of('/');
+  if (slash == std::string::npos) return { ".", path };
+  return {
+    path.substr(0, std::max<std::size_t>(slash, 1)),
+    path.substr(slash + 1) };
+}
@@ -0,0 +1,109 @@
+#ifndef __OPENGL_TUTORIAL_SHADER_WATCHER_H__
+#define __OPENGL_TUTORIAL_SHADER_WATCHER_H__
+
+#include "shader.h"
+#include "shader_preprocessor.h"
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+// Rebuilds shaders when their source files change on disk.
+// A background thread waits for inotify events and preprocesses the changed
+// sources again, watching any file they newly #include.
+// The new program is submitted and swapped in by update(), which must be
+// called on the thread which owns the GL context, between frames, and which
+// called watch() (asserted in debug builds). If the new
+// program fails to build then the old one keeps running.
+class ShaderWatcher
+{
+public:
+  ShaderWatcher();
+  ~ShaderWatcher();
+
+  ShaderWatcher(const ShaderWatcher&) = delete;
+  ShaderWatcher& operator=(const ShaderWatcher&) = delete;
+
+  // Rebuild the shader from the given files whenever either of them, or a
+  // file they #include, changes. They are expanded by ShaderPreprocessor with
+  // the given defines, as for the first build. The shader must outlive the
+  // watcher.
+  void watch(
+    Shader& shader,
+    const std::string& vertexPath,
+    const std::string& fragmentPath,
+    ShaderDefines defines = {});
+
+  // Submit the programs whose sources have changed and swap in the ones
+  // which have finished building. Returns the number of shaders replaced.
+  int update();
+
+private:
+  struct Watched
+  {
+    Shader* shader;
+    std::string vertexPath;
+    std::string fragmentPath;
+    ShaderDefines defines;
+
+    // Every file the sources were expanded from, includes and all.
+    std::vector<std::string> files;
+
+    // The rebuilt program, while the driver is still working on it.
+    std::unique_ptr<PendingShader> pending;
+  };
+
+  // Sources which have been read by the background thread.
+  struct Changed
+  {
+    std::size_t index;
+    std::string vertexCode;
+    std::string fragmentCode;
+  };
+
+  int inotifyFd;
+  int stopFd;
+  std::thread thread;
+
+  // The thread which called watch() and updates the shaders.
+  std::thread::id owner;
+
+  std::mutex mutex;
+  std::vector<Watched> watched;
+  std::map<int, std::string> directories;
+  std::vector<Changed> changed;
+
+  void run();
+  void readEvents(std::set<std::size_t>& indices);
+
+  // Watch the directory of a file. The mutex must be held.
+  bool watchDirectory(const std::string& path);
+
+  // Expand both sources, returning the files they were read from. Prints a
+  // message and throws if one cannot be read.
+  static std::vector<std::string> preprocess(
+    const std::string& vertexPath,
+    const std::string& fragmentPath,
+    const ShaderDefines& defines,
+    std::string& vertexCode,
+    std::string& fragmentCode);
+
+  static std::pair<std::string, std::string> splitPath(const std::string& path);
+};
+
+#endif // __OPENGL_TUTORIAL_SHADER_WATCHER_H__
@@ -0,0 +1,27 @@
+#include "std140.h"
+
+unsigned std140::Layout::add(std::string name, Type type, unsigned count)
+{
+  const unsigned offset = memberOffset(end, type, count);
+  end = offset + memberSize(type, count);
+  entries.push_back({ std::move(name), type, count, offset });
+  return offset;
+}
+
+std::string std140::Layout::declaration(std::string_view blockName) const
+{
+  std::string code = "layout (std140) uniform ";
+  code.append(blockName.data(), blockName.size());
+  code += "\n{\n";
+  for (const Member& member : entries)
+  {
+    code += "  ";
+    code += glslName(member.type);
+    code += " " + member.name;
+    if (member.count > 0) code += "[" + std::to_string(member.count) + "]";
+    code += ";\n";
+  }
+
+  code += "};\n";
+  return code;
+}
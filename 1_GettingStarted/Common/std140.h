@@ -0,0 +1,137 @@
+#ifndef __OPENGL_TUTORIAL_STD140_H__
+#define __OPENGL_TUTORIAL_STD140_H__
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// The std140 layout rules for uniform blocks (section 7.6.2.2 of the GL 4.5
+// specification). Nothing in here needs a GL context.
+namespace std140
+{
+  enum class Type
+  {
+    Float, Int, UInt, Bool,
+    Vec2, Vec3, Vec4,
+    IVec2, IVec3, IVec4,
+    Mat3, Mat4
+  };
+
+  // The number of scalar components in each column of the type.
+  constexpr unsigned components(Type type)
+  {
+    switch (type)
+    {
+      case Type::Vec2: case Type::IVec2: return 2;
+      case Type::Vec3: case Type::IVec3: case Type::Mat3: return 3;
+      case Type::Vec4: case Type::IVec4: case Type::Mat4: return 4;
+      default: return 1;
+    }
+  }
+
+  // The number of columns (1 for everything but matrices).
+  constexpr unsigned columns(Type type)
+  {
+    return type == Type::Mat3 ? 3 : type == Type::Mat4 ? 4 : 1;
+  }
+
+  constexpr bool isMatrix(Type type)
+  {
+    return columns(type) > 1;
+  }
+
+  // The base alignment of a single value of the type.
+  // Three component vectors are aligned like four component ones, and matrix
+  // columns like vec4s.
+  constexpr unsigned alignment(Type type)
+  {
+    if (isMatrix(type)) return 16;
+    unsigned n = components(type);
+    return 4 * (n == 3 ? 4 : n);
+  }
+
+  // The number of bytes a single value of the type occupies.
+  constexpr unsigned size(Type type)
+  {
+    return isMatrix(type) ? 16 * columns(type) : 4 * components(type);
+  }
+
+  // The distance between array elements, which is rounded up to a vec4.
+  constexpr unsigned arrayStride(Type type)
+  {
+    return (std::max)(16u, (size(type) + 15) / 16 * 16);
+  }
+
+  constexpr unsigned alignUp(unsigned offset, unsigned alignment)
+  {
+    return (offset + alignment - 1) / alignment * alignment;
+  }
+
+  // The offset of a member placed after the given end of the previous one,
+  // and the number of bytes it takes (count is 0 for a single value).
+  // Arrays are aligned like their stride.
+  constexpr unsigned memberOffset(unsigned end, Type type, unsigned count)
+  {
+    return alignUp(end, count > 0 ? arrayStride(type) : alignment(type));
+  }
+
+  constexpr unsigned memberSize(Type type, unsigned count)
+  {
+    return count > 0 ? arrayStride(type) * count : size(type);
+  }
+
+  constexpr const char* glslName(Type type)
+  {
+    switch (type)
+    {
+      case Type::Float: return "float";
+      case Type::Int: return "int";
+      case Type::UInt: return "uint";
+      case Type::Bool: return "bool";
+      case Type::Vec2: return "vec2";
+      case Type::Vec3: return "vec3";
+      case Type::Vec4: return "vec4";
+      case Type::IVec2: return "ivec2";
+      case Type::IVec3: return "ivec3";
+      case Type::IVec4: return "ivec4";
+      case Type::Mat3: return "mat3";
+      case Type::Mat4: return "mat4";
+    }
+
+    return "";
+  }
+
+  struct Member
+  {
+    std::string name;
+    Type type;
+
+    // The array length, or 0 for a single value.
+    unsigned count;
+
+    unsigned offset;
+  };
+
+  // The members of a uniform block and where std140 puts them.
+  class Layout
+  {
+  public:
+    // Append a member and return its offset from the start of the block.
+    unsigned add(std::string name, Type type, unsigned count = 0);
+
+    // The size of the whole block, padded to a vec4 like a structure.
+    unsigned size() const { return alignUp(end, 16); }
+
+    const std::vector<Member>& members() const { return entries; }
+
+    // The GLSL declaration of a block with this layout.
+    std::string declaration(std::string_view blockName) const;
+
+  private:
+    std::vector<Member> entries;
+    unsigned end = 0;
+  };
+}
+
+#endif // __OPENGL_TUTORIAL_STD140_H__
@@ -0,0 +1,1366 @@
+// Generates glad.h, glad.c and GLReplay's replay_calls.h from the Khronos
+// registry header glcorearb.h and a selection of the GL API, for Glad.cmake.
+//
+//   glad_generate <registry header> <api file> <template> <output file>
+//                 [<template> <output file>]...
+//
+// The registry header (Common/glad/glcorearb.h) declares the enums and
+// commands of each version and extension. The API file
+// (Common/glad/gl_api.txt) selects the version and extensions to load, and
+// describes with indented lines after a command how it is counted, traced
+// and replayed; its header describes them. A template is copied to its
+// output file with each line which is only "@SECTION@" replaced by the
+// generated code of that section, and "@FUNCTION_COUNT@", "@MAX_MAJOR@" and
+// "@MAX_MINOR@" replaced anywhere by their values. Everything else in glad is
+// written by hand in the templates.
+//
+// A command's index, which the counters and traces use, is the order it is
+// first declared in by the selected features.
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  struct Param
+  {
+    std::string type;
+    std::string name;
+
+    // How the tracing writes the parameter and the replay reads it: empty
+    // for a value written as it is, else one of the kinds in gl_api.txt with
+    // its arguments.
+    std::string kind;
+    std::string kindArgs;
+  };
+
+  struct Command
+  {
+    int index = 0;
+    std::string ret;
+    std::string name;
+    std::string params;
+    std::vector<Param> paramList;
+
+    std::vector<std::string> counts;
+    bool traced = true;
+    std::vector<std::string> order;
+    std::string result;
+    std::string resultArgs;
+    std::vector<std::string> traceBefore;
+    std::vector<std::string> traceAfter;
+    std::vector<std::string> replayBefore;
+    std::vector<std::string> replayCall;
+    std::vector<std::string> replayAfter;
+  };
+
+  struct Feature
+  {
+    std::string name; // GL_VERSION_1_0 or GL_KHR_debug
+    bool version = false;
+    int major = 0;
+    int minor = 0;
+
+    // The commands the feature declares, and all those it loads.
+    std::vector<int> declared;
+    std::vector<int> loaded;
+  };
+
+  struct Api
+  {
+    std::vector<std::pair<std::string, std::string>> enums;
+    std::vector<Feature> features;
+    std::vector<Command> commands;
+    std::map<std::string, int> indices;
+  };
+
+  bool readFile(const std::string& path, std::string& contents)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    contents.assign(
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+  }
+
+  bool isNameChar(char c)
+  {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+  }
+
+  // Split off the first word of text, leaving the rest in text.
+  std::string firstWord(std::string& text)
+  {
+    const std::size_t space = text.find(' ');
+    const std::string word = text.substr(0, space);
+    text = space == text.npos ? "" : text.substr(space + 1);
+    return word;
+  }
+
+  std::vector<std::string> words(std::string text)
+  {
+    std::vector<std::string> result;
+    while (!text.empty()) result.push_back(firstWord(text));
+    return result;
+  }
+
+  std::string join(const std::vector<std::string>& parts)
+  {
+    std::string result;
+    for (const std::string& part : parts)
+    {
+      if (!result.empty()) result += ", ";
+      result += part;
+    }
+
+    return result;
+  }
+
+  std::vector<Param> splitParams(const std::string& params)
+  {
+    std::vector<Param> result;
+    if (params == "void") return result;
+
+    std::size_t start = 0;
+    while (start < params.size())
+    {
+      std::size_t end = params.find(", ", start);
+      if (end == params.npos) end = params.size();
+
+      std::size_t nameStart = end;
+      while (nameStart > start && isNameChar(params[nameStart - 1]))
+      {
+        nameStart--;
+      }
+
+      std::size_t typeEnd = nameStart;
+      while (typeEnd > start && params[typeEnd - 1] == ' ') typeEnd--;
+
+      Param param;
+      param.type = params.substr(start, typeEnd - start);
+      param.name = params.substr(nameStart, end - nameStart);
+      result.push_back(param);
+      start = end + 2;
+    }
+
+    return result;
+  }
+
+  bool parseAnnotation(Command& command, std::string text, std::string& error)
+  {
+    const std::string word = firstWord(text);
+    if (word == "count")
+    {
+      command.counts.push_back(text);
+    }
+    else if (word == "notrace")
+    {
+      command.traced = false;
+    }
+    else if (word == "param")
+    {
+      const std::string name = firstWord(text);
+      for (Param& param : command.paramList)
+      {
+        if (param.name == name)
+        {
+          param.kind = firstWord(text);
+          param.kindArgs = text;
+          return true;
+        }
+      }
+
+      error = command.name + " has no parameter " + name;
+      return false;
+    }
+    else if (word == "order")
+    {
+      command.order = words(text);
+    }
+    else if (word == "result")
+    {
+      command.result = firstWord(text);
+      command.resultArgs = text;
+    }
+    else if (word == "trace" || word == "replay")
+    {
+      const std::string when = firstWord(text);
+      std::vector<std::string>* lines = nullptr;
+      if (word == "trace" && when == "before") lines = &command.traceBefore;
+      if (word == "trace" && when == "after") lines = &command.traceAfter;
+      if (word == "replay" && when == "before") lines = &command.replayBefore;
+      if (word == "replay" && when == "call") lines = &command.replayCall;
+      if (word == "replay" && when == "after") lines = &command.replayAfter;
+      if (lines == nullptr)
+      {
+        error = "Unknown " + word + " hook " + when;
+        return false;
+      }
+
+      lines->push_back(text);
+    }
+    else
+    {
+      error = "Unknown annotation " + word;
+      return false;
+    }
+
+    return true;
+  }
+
+  // What the Khronos header declares in the section of one version or
+  // extension, between "#ifndef GL_<name>" and "#endif /* GL_<name> */".
+  struct RegistrySection
+  {
+    std::vector<std::pair<std::string, std::string>> enums;
+    std::vector<Command> commands;
+  };
+
+  struct Registry
+  {
+    // The sections in the order the header declares them.
+    std::vector<std::string> order;
+    std::map<std::string, RegistrySection> sections;
+
+    // Every enum and command, by name.
+    std::map<std::string, std::string> enums;
+    std::map<std::string, Command> commands;
+  };
+
+  std::string trimRight(std::string text)
+  {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(
+             text.back())))
+    {
+      text.pop_back();
+    }
+
+    return text;
+  }
+
+  // Read the sections of glcorearb.h. Its commands are declared as
+  //   GLAPI <return type>APIENTRY <name> (<parameters>);
+  // and its enums as
+  //   #define <name> <value>
+  bool parseRegistry(
+    const std::string& contents,
+    Registry& registry,
+    std::string& error)
+  {
+    std::istringstream lines(contents);
+    std::string line;
+    std::string section;
+    while (std::getline(lines, line))
+    {
+      line = trimRight(line);
+      if (section.empty())
+      {
+        if (line.compare(0, 11, "#ifndef GL_") == 0)
+        {
+          section = line.substr(8);
+          registry.order.push_back(section);
+          registry.sections[section];
+        }
+
+        continue;
+      }
+
+      if (line == "#endif /* " + section + " */")
+      {
+        section.clear();
+        continue;
+      }
+
+      RegistrySection& current = registry.sections[section];
+      if (line.compare(0, 11, "#define GL_") == 0)
+      {
+        std::istringstream words(line.substr(8));
+        std::string name, value;
+        words >> name >> value;
+        if (name == section || value.empty()) continue;
+
+        current.enums.emplace_back(name, value);
+        registry.enums[name] = value;
+      }
+      else if (line.compare(0, 6, "GLAPI ") == 0)
+      {
+        const std::size_t apientry = line.find("APIENTRY ");
+        const std::size_t open = line.find(" (", apientry);
+        if (apientry == line.npos || open == line.npos ||
+            line.compare(line.size() - 2, 2, ");") != 0)
+        {
+          error = "Malformed command in the registry: " + line;
+          return false;
+        }
+
+        Command command;
+        command.ret = trimRight(line.substr(6, apientry - 6));
+        command.name = line.substr(apientry + 9, open - apientry - 9);
+        command.params = line.substr(open + 2, line.size() - open - 4);
+        command.paramList = splitParams(command.params);
+        current.commands.push_back(command);
+        registry.commands[command.name] = command;
+      }
+    }
+
+    if (!section.empty())
+    {
+      error = "The registry's section " + section + " is not closed";
+      return false;
+    }
+
+    return true;
+  }
+
+  // Add a command from the registry to the feature being built: declared by
+  // it if no earlier feature declared it, and loaded by it either way.
+  void addCommand(const Command& declared, Api& api)
+  {
+    Feature& feature = api.features.back();
+    const auto found = api.indices.find(declared.name);
+    if (found != api.indices.end())
+    {
+      feature.loaded.push_back(found->second);
+      return;
+    }
+
+    Command command = declared;
+    command.index = static_cast<int>(api.commands.size());
+    api.indices.emplace(command.name, command.index);
+    api.commands.push_back(command);
+    feature.declared.push_back(command.index);
+    feature.loaded.push_back(command.index);
+  }
+
+  void addEnum(
+    const std::string& name,
+    const std::string& value,
+    std::map<std::string, bool>& added,
+    Api& api)
+  {
+    if (added[name]) return;
+    added[name] = true;
+    api.enums.emplace_back(name, value);
+  }
+
+  void addSection(
+    const RegistrySection& section,
+    std::map<std::string, bool>& added,
+    Api& api)
+  {
+    for (const auto& value : section.enums)
+    {
+      addEnum(value.first, value.second, added, api);
+    }
+
+    for (const Command& command : section.commands) addCommand(command, api);
+  }
+
+  // Select the features of the API from the registry, then annotate their
+  // commands.
+  bool parseApi(
+    const std::string& contents,
+    const Registry& registry,
+    Api& api,
+    std::string& error)
+  {
+    std::istringstream lines(contents);
+    std::string line;
+    std::map<std::string, bool> added;
+    std::map<std::string, std::vector<std::string>> annotations;
+    std::vector<std::string>* annotating = nullptr;
+    while (std::getline(lines, line))
+    {
+      if (line.empty() || line[0] == '#') continue;
+
+      if (line.compare(0, 2, "  ") == 0)
+      {
+        if (annotating == nullptr)
+        {
+          error = "Annotation outside a command: " + line;
+          return false;
+        }
+
+        annotating->push_back(line.substr(2));
+        continue;
+      }
+
+      std::string text = line;
+      const std::string word = firstWord(text);
+      annotating = nullptr;
+      if (word == "version")
+      {
+        if (!api.features.empty())
+        {
+          error = "The version must come before the extensions";
+          return false;
+        }
+
+        const std::string last = "GL_VERSION_" + text.substr(0, 1) + "_" +
+                                  text.substr(text.find('.') + 1);
+        bool found = false;
+        for (const std::string& name : registry.order)
+        {
+          if (name.compare(0, 11, "GL_VERSION_") != 0) continue;
+
+          Feature feature;
+          feature.version = true;
+          feature.name = name;
+          feature.major = std::stoi(name.substr(11, 1));
+          feature.minor = std::stoi(name.substr(13));
+          api.features.push_back(feature);
+          addSection(registry.sections.at(name), added, api);
+
+          if (name == last)
+          {
+            found = true;
+            break;
+          }
+        }
+
+        if (!found)
+        {
+          error = "The registry has no " + last;
+          return false;
+        }
+      }
+      else if (word == "extension")
+      {
+        const auto section = registry.sections.find(text);
+        if (section == registry.sections.end())
+        {
+          error = "The registry has no extension " + text;
+          return false;
+        }
+
+        Feature feature;
+        feature.name = text;
+        api.features.push_back(feature);
+        addSection(section->second, added, api);
+      }
+      else if (word == "require")
+      {
+        if (api.features.empty() || api.features.back().version)
+        {
+          error = "require outside an extension: " + line;
+          return false;
+        }
+
+        for (const std::string& name : words(text))
+        {
+          const auto command = registry.commands.find(name);
+          const auto value = registry.enums.find(name);
+          if (command != registry.commands.end())
+          {
+            addCommand(command->second, api);
+          }
+          else if (value != registry.enums.end())
+          {
+            addEnum(name, value->second, added, api);
+          }
+          else
+          {
+            error = "The registry has no " + name;
+            return false;
+          }
+        }
+      }
+      else if (word == "command")
+      {
+        annotating = &annotations[text];
+      }
+      else
+      {
+        error = "Unknown line: " + line;
+        return false;
+      }
+    }
+
+    for (const auto& annotated : annotations)
+    {
+      const auto index = api.indices.find(annotated.first);
+      if (index == api.indices.end())
+      {
+        error = annotated.first + " is annotated but not in the API";
+        return false;
+      }
+
+      Command& command = api.commands[index->second];
+      for (const std::string& annotation : annotated.second)
+      {
+        if (!parseAnnotation(command, annotation, error)) return false;
+      }
+    }
+
+    return true;
+  }
+
+  // The names glad gives a command.
+  std::string pfn(const Command& command)
+  {
+    std::string result = "PFN";
+    for (char c : command.name)
+    {
+      result += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+
+    return result + "PROC";
+  }
+
+  std::string memberName(const Command& command)
+  {
+    return command.name.substr(2);
+  }
+
+  std::string memberName(const Feature& feature)
+  {
+    return feature.name.substr(3);
+  }
+
+  std::string callArgs(const Command& command)
+  {
+    std::vector<std::string> names;
+    for (const Param& param : command.paramList) names.push_back(param.name);
+    return join(names);
+  }
+
+  std::string returnIfAny(const Command& command)
+  {
+    return command.ret == "void" ? "" : "return ";
+  }
+
+  // The C++ spelling of a type in replay_calls.h: "const GLchar *const*"
+  // is written "const GLchar* const*".
+  std::string replayType(std::string type)
+  {
+    std::size_t pos;
+    while ((pos = type.find(" *")) != type.npos) type.erase(pos, 1);
+    pos = 0;
+    while ((pos = type.find("*const", pos)) != type.npos)
+    {
+      type.insert(pos + 1, " ");
+      pos += 2;
+    }
+
+    return type;
+  }
+
+  // The type of the elements a pointer type points at.
+  std::string elementType(std::string type)
+  {
+    if (type.compare(0, 6, "const ") == 0) type.erase(0, 6);
+    while (!type.empty() && (type.back() == '*' || type.back() == ' '))
+    {
+      type.pop_back();
+    }
+
+    return type;
+  }
+
+  // The parameters in the order the trace records them.
+  std::vector<const Param*> traceOrder(const Command& command)
+  {
+    std::vector<const Param*> result;
+    if (command.order.empty())
+    {
+      for (const Param& param : command.paramList)
+      {
+        if (param.kind != "skip") result.push_back(&param);
+      }
+    }
+    else
+    {
+      for (const std::string& name : command.order)
+      {
+        for (const Param& param : command.paramList)
+        {
+          if (param.name == name) result.push_back(&param);
+        }
+      }
+    }
+
+    return result;
+  }
+
+  // Sections of glad.h.
+  void writeEnums(const Api& api, std::ostream& out)
+  {
+    for (const auto& value : api.enums)
+    {
+      out << "#define " << value.first << ' ' << value.second << '\n';
+    }
+  }
+
+  void writeFeatures(const Api& api, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      out << "#ifndef " << feature.name << '\n'
+          << "#define " << feature.name << " 1\n"
+          << "GLAPI int GLAD_" << feature.name << ";\n";
+      for (int index : feature.declared)
+      {
+        const Command& command = api.commands[index];
+        out << "typedef " << command.ret << " (APIENTRYP " << pfn(command)
+            << ")(" << command.params << ");\n"
+            << "GLAPI " << pfn(command) << " glad_" << command.name << ";\n"
+            << "#define " << command.name << " glad_" << command.name << '\n';
+      }
+
+      out << "#endif\n";
+    }
+  }
+
+  void writeContextMembers(const Api& api, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      out << "\tint " << memberName(feature) << ";\n";
+    }
+
+    for (const Command& command : api.commands)
+    {
+      out << '\t' << pfn(command) << ' ' << memberName(command) << ";\n";
+    }
+  }
+
+  void writeContextNames(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      out << "#undef " << command.name << '\n'
+          << "#define " << command.name << " (glad_gl_context->"
+          << memberName(command) << ")\n";
+    }
+  }
+
+  void writeCountedDeclarations(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      out << "GLAPI " << command.ret << " APIENTRY glad_counted_"
+          << command.name << '(' << command.params << ");\n";
+    }
+  }
+
+  void writeCountedNames(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      out << "#undef " << command.name << '\n'
+          << "#define " << command.name << " glad_counted_" << command.name
+          << '\n';
+    }
+  }
+
+  // Sections of glad.c.
+  void writePointers(const Api& api, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      if (feature.version) out << "int GLAD_" << feature.name << " = 0;\n";
+    }
+
+    std::map<std::string, const Command*> core;
+    for (const Feature& feature : api.features)
+    {
+      if (!feature.version) continue;
+      for (int index : feature.declared)
+      {
+        core[api.commands[index].name] = &api.commands[index];
+      }
+    }
+
+    for (const auto& named : core)
+    {
+      out << pfn(*named.second) << " glad_" << named.first << " = NULL;\n";
+    }
+
+    for (const Feature& feature : api.features)
+    {
+      if (feature.version) continue;
+      out << "int GLAD_" << feature.name << " = 0;\n";
+      for (int index : feature.declared)
+      {
+        const Command& command = api.commands[index];
+        out << pfn(command) << " glad_" << command.name << " = NULL;\n";
+      }
+    }
+  }
+
+  void writeLoaders(const Api& api, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      // glad_prune may remove every load() from a loader, and with
+      // GLAD_MULTI_CONTEXT it removes them all, since calls go through the
+      // tables instead.
+      out << "static void load_" << feature.name << "(GLADloadproc load) {\n"
+          << "\t(void)load;\n"
+          << "\tif(!GLAD_" << feature.name << ") return;\n";
+      for (int index : feature.loaded)
+      {
+        const Command& command = api.commands[index];
+        out << "\tglad_" << command.name << " = (" << pfn(command) << ")load(\""
+            << command.name << "\");\n";
+      }
+
+      out << "}\n";
+    }
+  }
+
+  void writeFindExtensions(const Api& api, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      if (feature.version) continue;
+      out << "\tGLAD_" << feature.name << " = has_ext(\"" << feature.name
+          << "\");\n";
+    }
+  }
+
+  void writeFindCore(
+    const Api& api, const std::string& prefix, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      if (!feature.version) continue;
+      out << '\t' << prefix
+          << (prefix == "GLAD_" ? feature.name : memberName(feature))
+          << " = (major == " << feature.major << " && minor >= "
+          << feature.minor << ") || major > " << feature.major << ";\n";
+    }
+  }
+
+  void writeContextFindExtension(const Api& api, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      if (feature.version) continue;
+      out << "\tif (length == " << feature.name.size() << " && strncmp(name, \""
+          << feature.name << "\", " << feature.name.size()
+          << ") == 0) context->" << memberName(feature) << " = 1;\n";
+    }
+  }
+
+  void writeContextLoaders(const Api& api, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      out << "static void context_load_" << feature.name
+          << "(struct gladGLContext *context, GLADloadproc load) {\n"
+          << "\tif(!context->" << memberName(feature) << ") return;\n";
+      for (int index : feature.loaded)
+      {
+        const Command& command = api.commands[index];
+        out << "\tcontext->" << memberName(command) << " = (" << pfn(command)
+            << ")load(\"" << command.name << "\");\n";
+      }
+
+      out << "}\n";
+    }
+  }
+
+  // A call of each version's or each extension's function, as
+  // "<prefix>GL_X<suffix>".
+  void writeFeatureCalls(
+    const Api& api,
+    bool versions,
+    const std::string& prefix,
+    const std::string& suffix,
+    std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      if (feature.version != versions) continue;
+      out << '\t' << prefix << feature.name << suffix << '\n';
+    }
+  }
+
+  void writeNames(const Api& api, const std::string& indent, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      out << indent << '"' << command.name << "\",\n";
+    }
+  }
+
+  void writeCountedWrappers(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      out << command.ret << " APIENTRY glad_counted_" << command.name << '('
+          << command.params << ") {\n"
+          << "\tcount_call(" << command.index << ");\n";
+      for (std::string count : command.counts)
+      {
+        const std::string kind = firstWord(count);
+        if (kind == "state")
+        {
+          out << "\tcounters_current.state_changes++;\n";
+        }
+        else
+        {
+          out << "\tcount_" << kind << '(' << count << ");\n";
+        }
+      }
+
+      out << '\t' << returnIfAny(command) << "counted_call("
+          << memberName(command) << ")(" << callArgs(command) << ");\n"
+          << "}\n";
+    }
+  }
+
+  // glGetString is looked up before anything else, so it is never lazy.
+  bool isLazy(const Command& command)
+  {
+    return command.name != "glGetString";
+  }
+
+  void writeLazyTrampolines(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      if (!isLazy(command)) continue;
+      const std::string call = "real(" + callArgs(command) + ")";
+      out << "static " << command.ret << " APIENTRY lazy_" << command.name
+          << '(' << command.params << ") {\n"
+          << '\t' << pfn(command) << " real = (" << pfn(command)
+          << ")lazy_load(\"" << command.name << "\");\n"
+          << "\tlazy_patch(glad_" << command.name << ", real);\n";
+      if (command.ret == "void")
+      {
+        out << "\tif(real != NULL) " << call << ";\n";
+      }
+      else
+      {
+        out << "\treturn real != NULL ? " << call << " : 0;\n";
+      }
+
+      out << "}\n";
+    }
+  }
+
+  void writeLazyInstallers(const Api& api, std::ostream& out)
+  {
+    for (const Feature& feature : api.features)
+    {
+      out << "static void lazy_" << feature.name << "(void) {\n"
+          << "\tif(!GLAD_" << feature.name << ") return;\n";
+      for (int index : feature.loaded)
+      {
+        const Command& command = api.commands[index];
+        if (!isLazy(command)) continue;
+        out << "\tglad_" << command.name << " = lazy_" << command.name
+            << ";\n";
+      }
+
+      out << "}\n";
+    }
+  }
+
+  // The line which writes a parameter to the trace, if it is written before
+  // the call.
+  std::string traceParam(const Param& param)
+  {
+    const std::string& p = param.name;
+    std::string args = param.kindArgs;
+    if (param.kind.empty() || param.kind == "name" ||
+        param.kind == "location" || param.kind == "block_index" ||
+        param.kind == "sync")
+    {
+      return "trace_write(&" + p + ", sizeof " + p + ");";
+    }
+
+    if (param.kind == "array")
+    {
+      return "trace_payload(" + p + ", trace_count(" + args + ") * sizeof *" +
+             p + ");";
+    }
+
+    if (param.kind == "names")
+    {
+      firstWord(args);
+      return "trace_payload(" + p + ", trace_count(" + args + ") * sizeof *" +
+             p + ");";
+    }
+
+    if (param.kind == "bytes")
+    {
+      return "trace_payload(" + p + ", (size_t)" + args + ");";
+    }
+
+    if (param.kind == "string") return "trace_string(" + p + ");";
+    if (param.kind == "string_length")
+    {
+      return "trace_string_length(" + p + ", " + args + ");";
+    }
+
+    if (param.kind == "strings")
+    {
+      const std::string count = firstWord(args);
+      return "trace_strings(" + count + ", " + p + ", " + args + ");";
+    }
+
+    if (param.kind == "offset") return "trace_offset(" + p + ");";
+    if (param.kind == "offsets")
+    {
+      return "trace_offsets(" + args + ", " + p + ");";
+    }
+
+    if (param.kind == "pixels") return "trace_pixels(" + p + ", " + args + ");";
+    if (param.kind == "pixels_out")
+    {
+      return "trace_pixels_out(" + p + ", " + args + ");";
+    }
+
+    return "";
+  }
+
+  // The line which writes the object names a call generated.
+  std::string traceGenerated(const Param& param)
+  {
+    std::string args = param.kindArgs;
+    firstWord(args);
+    return "trace_payload(" + param.name + ", trace_count(" + args +
+           ") * sizeof *" + param.name + ");";
+  }
+
+  bool checkTraceKinds(const Api& api, std::string& error)
+  {
+    static const char* const kinds[] =
+    {
+      "", "name", "location", "block_index", "sync", "array", "names", "gen",
+      "bytes", "string", "string_length", "strings", "offset", "offsets",
+      "pixels", "pixels_out", "skip"
+    };
+
+    for (const Command& command : api.commands)
+    {
+      for (const Param& param : command.paramList)
+      {
+        bool known = false;
+        for (const char* kind : kinds) known = known || param.kind == kind;
+        if (!known)
+        {
+          error = command.name + ": unknown parameter kind " + param.kind;
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  void writeTraceWrappers(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      if (!command.traced) continue;
+
+      const std::string real = "((" + pfn(command) + ")trace_real[" +
+                               std::to_string(command.index) + "])(" +
+                               callArgs(command) + ");";
+      out << "static " << command.ret << " APIENTRY trace_" << command.name
+          << '(' << command.params << ") {\n"
+          << "\ttrace_call(" << command.index << ");\n";
+      for (const Param* param : traceOrder(command))
+      {
+        const std::string line = traceParam(*param);
+        if (!line.empty()) out << '\t' << line << '\n';
+      }
+
+      for (const std::string& line : command.traceBefore)
+      {
+        out << '\t' << line << '\n';
+      }
+
+      if (command.ret == "void")
+      {
+        out << '\t' << real << '\n';
+        for (const Param& param : command.paramList)
+        {
+          if (param.kind == "gen") out << '\t' << traceGenerated(param) << '\n';
+        }
+
+        for (const std::string& line : command.traceAfter)
+        {
+          out << '\t' << line << '\n';
+        }
+      }
+      else
+      {
+        out << "\t{\n"
+            << "\t\t" << command.ret << " result = " << real << '\n';
+        if (!command.result.empty())
+        {
+          out << "\t\ttrace_write(&result, sizeof result);\n";
+        }
+
+        for (const std::string& line : command.traceAfter)
+        {
+          out << "\t\t" << line << '\n';
+        }
+
+        out << "\t\treturn result;\n"
+            << "\t}\n";
+      }
+
+      out << "}\n";
+    }
+  }
+
+  void writeTraceBegin(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      if (!command.traced) continue;
+      const std::string pointer = "glad_" + command.name;
+      out << "\tif(" << pointer << " == lazy_" << command.name << ") "
+          << pointer << " = (" << pfn(command) << ")lazy_load(\""
+          << command.name << "\");\n"
+          << '\t' << pointer << " = (" << pfn(command) << ")trace_wrap("
+          << command.index << ", (void (*)(void))" << pointer
+          << ", (void (*)(void))trace_" << command.name << ");\n";
+    }
+  }
+
+  void writeTraceEnd(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      if (!command.traced) continue;
+      out << "\tif(trace_real[" << command.index << "] != NULL) glad_"
+          << command.name << " = (" << pfn(command) << ")trace_real["
+          << command.index << "];\n";
+    }
+  }
+
+  // Sections of replay_calls.h.
+  void replayParam(const Param& param, std::vector<std::string>& lines)
+  {
+    const std::string& p = param.name;
+    const std::string type = replayType(param.type);
+    const std::string element = elementType(param.type);
+    std::string args = param.kindArgs;
+    if (param.kind.empty())
+    {
+      lines.push_back(type + " " + p + " = in.read<" + type + ">();");
+    }
+    else if (param.kind == "name")
+    {
+      lines.push_back(type + " " + p + "Traced = in.read<" + type + ">();");
+      lines.push_back(type + " " + p + " = state.name(ReplayNames::" + args +
+                      ", " + p + "Traced);");
+    }
+    else if (param.kind == "location")
+    {
+      lines.push_back(type + " " + p + " = state.location(" + args +
+                      ", in.read<" + type + ">());");
+    }
+    else if (param.kind == "block_index")
+    {
+      lines.push_back(type + " " + p + " = state.blockIndex(programTraced, " +
+                      "in.read<" + type + ">());");
+    }
+    else if (param.kind == "sync")
+    {
+      lines.push_back(type + " " + p + " = state.sync(in.read<" + type +
+                      ">());");
+    }
+    else if (param.kind == "array" || param.kind == "string" ||
+             param.kind == "string_length")
+    {
+      lines.push_back(type + " " + p + " = in.array<" + element + ">();");
+    }
+    else if (param.kind == "names")
+    {
+      const std::string names = firstWord(args);
+      lines.push_back(type + " " + p + " = state.names(ReplayNames::" + names +
+                      ", in.array<" + element + ">(), " + args + ");");
+    }
+    else if (param.kind == "gen")
+    {
+      firstWord(args);
+      lines.push_back(type + " " + p + " = state.scratchNames(" + args + ");");
+    }
+    else if (param.kind == "bytes")
+    {
+      lines.push_back(type + " " + p + " = in.payload();");
+    }
+    else if (param.kind == "strings")
+    {
+      lines.push_back(type + " " + p + " = in.strings(" + firstWord(args) +
+                      ");");
+    }
+    else if (param.kind == "offset")
+    {
+      lines.push_back(type + " " + p + " = in.offset();");
+    }
+    else if (param.kind == "offsets")
+    {
+      lines.push_back(type + " " + p + " = in.offsets(" + args + ");");
+    }
+    else if (param.kind == "pixels")
+    {
+      lines.push_back(type + " " + p + " = in.pixels();");
+    }
+    else if (param.kind == "pixels_out")
+    {
+      lines.push_back(type + " " + p + " = in.pixelsOut();");
+    }
+  }
+
+  void writeReplayCases(const Api& api, std::ostream& out)
+  {
+    for (const Command& command : api.commands)
+    {
+      if (!command.traced) continue;
+
+      std::vector<std::string> lines;
+      for (const Param* param : traceOrder(command)) replayParam(*param, lines);
+      lines.insert(
+        lines.end(), command.replayBefore.begin(), command.replayBefore.end());
+
+      if (!command.replayCall.empty())
+      {
+        lines.insert(
+          lines.end(), command.replayCall.begin(), command.replayCall.end());
+      }
+      else
+      {
+        std::vector<std::string> args;
+        for (const Param& param : command.paramList)
+        {
+          args.push_back(param.kind == "skip" ? "nullptr" : param.name);
+        }
+
+        const std::string call = command.name + "(" + join(args) + ");";
+        lines.push_back(command.result.empty()
+                          ? call
+                          : replayType(command.ret) + " result = " + call);
+      }
+
+      for (const Param& param : command.paramList)
+      {
+        if (param.kind != "gen") continue;
+        std::string args = param.kindArgs;
+        const std::string names = firstWord(args);
+        lines.push_back("state.bindNames(ReplayNames::" + names +
+                        ", in.array<" + elementType(param.type) + ">(), " +
+                        param.name + ", " + args + ");");
+      }
+
+      const std::string resultType = replayType(command.ret);
+      if (command.result == "name")
+      {
+        lines.push_back(
+          resultType + " traced = in.read<" + resultType + ">();");
+        lines.push_back("state.bindNames(ReplayNames::" + command.resultArgs +
+                        ", &traced, &result, 1);");
+      }
+      else if (command.result == "location")
+      {
+        lines.push_back("state.bindLocation(programTraced, in.read<" +
+                        resultType + ">(), result);");
+      }
+      else if (command.result == "block_index")
+      {
+        lines.push_back("state.bindBlockIndex(programTraced, in.read<" +
+                        resultType + ">(), result);");
+      }
+      else if (command.result == "sync")
+      {
+        lines.push_back("state.bindSync(in.read<" + resultType +
+                        ">(), result);");
+      }
+
+      lines.insert(
+        lines.end(), command.replayAfter.begin(), command.replayAfter.end());
+      lines.push_back("return true;");
+
+      out << "    case " << command.index << ": // " << command.name << '\n'
+          << "    {\n";
+      for (const std::string& line : lines) out << "      " << line << '\n';
+      out << "    }\n";
+    }
+  }
+
+  std::map<std::string, std::string> generateSections(const Api& api)
+  {
+    std::map<std::string, std::ostringstream> out;
+    writeEnums(api, out["ENUMS"]);
+    writeFeatures(api, out["FEATURES"]);
+    writeContextMembers(api, out["CONTEXT_MEMBERS"]);
+    writeContextNames(api, out["CONTEXT_NAMES"]);
+    writeCountedDeclarations(api, out["COUNTED_DECLARATIONS"]);
+    writeCountedNames(api, out["COUNTED_NAMES"]);
+
+    writePointers(api, out["POINTERS"]);
+    writeLoaders(api, out["LOADERS"]);
+    writeFindExtensions(api, out["FIND_EXTENSIONS"]);
+    writeFindCore(api, "GLAD_", out["FIND_CORE"]);
+    writeFeatureCalls(api, true, "load_", "(load);", out["LOAD_VERSIONS"]);
+    writeFeatureCalls(api, false, "load_", "(load);", out["LOAD_EXTENSIONS"]);
+    writeFindCore(api, "context->", out["CONTEXT_FIND_CORE"]);
+    writeContextFindExtension(api, out["CONTEXT_FIND_EXTENSION"]);
+    writeContextLoaders(api, out["CONTEXT_LOADERS"]);
+    writeFeatureCalls(api, true, "context_load_", "(context, load);",
+                      out["CONTEXT_LOAD_VERSIONS"]);
+    writeFeatureCalls(api, false, "context_load_", "(context, load);",
+                      out["CONTEXT_LOAD_EXTENSIONS"]);
+    writeNames(api, "\t", out["COUNTED_FUNCTION_NAMES"]);
+    writeCountedWrappers(api, out["COUNTED_WRAPPERS"]);
+    writeLazyTrampolines(api, out["LAZY_TRAMPOLINES"]);
+    writeLazyInstallers(api, out["LAZY_INSTALLERS"]);
+    writeFeatureCalls(api, true, "lazy_", "();", out["LAZY_VERSIONS"]);
+    writeFeatureCalls(api, false, "lazy_", "();", out["LAZY_EXTENSIONS"]);
+    writeNames(api, "\t", out["TRACE_NAMES"]);
+    writeTraceWrappers(api, out["TRACE_WRAPPERS"]);
+    writeTraceBegin(api, out["TRACE_BEGIN"]);
+    writeTraceEnd(api, out["TRACE_END"]);
+
+    writeNames(api, "  ", out["REPLAY_NAMES"]);
+    writeReplayCases(api, out["REPLAY_CASES"]);
+
+    std::map<std::string, std::string> sections;
+    for (const auto& section : out)
+    {
+      sections[section.first] = section.second.str();
+    }
+
+    return sections;
+  }
+
+  bool expand(
+    const std::string& input,
+    const std::map<std::string, std::string>& sections,
+    const std::map<std::string, std::string>& values,
+    std::string& output,
+    std::string& error)
+  {
+    std::istringstream lines(input);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+      if (line.size() > 2 && line.front() == '@' && line.back() == '@' &&
+          line.find(' ') == line.npos)
+      {
+        const auto found = sections.find(line.substr(1, line.size() - 2));
+        if (found == sections.end())
+        {
+          error = "Unknown section " + line;
+          return false;
+        }
+
+        output += found->second;
+        continue;
+      }
+
+      for (const auto& value : values)
+      {
+        const std::string token = "@" + value.first + "@";
+        std::size_t pos;
+        while ((pos = line.find(token)) != line.npos)
+        {
+          line.replace(pos, token.size(), value.second);
+        }
+      }
+
+      output += line + '\n';
+    }
+
+    return true;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 5 || argc % 2 != 1)
+  {
+    std::cerr << "Usage: glad_generate <registry header> <api file> "
+                 "<template> <output file> [<template> <output file>]..."
+              << std::endl;
+    return 2;
+  }
+
+  std::string header, contents;
+  if (!readFile(argv[1], header))
+  {
+    std::cerr << "Failed to read " << argv[1] << std::endl;
+    return 1;
+  }
+
+  if (!readFile(argv[2], contents))
+  {
+    std::cerr << "Failed to read " << argv[2] << std::endl;
+    return 1;
+  }
+
+  Registry registry;
+  Api api;
+  std::string error;
+  if (!parseRegistry(header, registry, error))
+  {
+    std::cerr << argv[1] << ": " << error << std::endl;
+    return 1;
+  }
+
+  if (!parseApi(contents, registry, api, error) ||
+      !checkTraceKinds(api, error))
+  {
+    std::cerr << argv[2] << ": " << error << std::endl;
+    return 1;
+  }
+
+  int maxMajor = 0, maxMinor = 0;
+  for (const Feature& feature : api.features)
+  {
+    if (feature.version)
+    {
+      maxMajor = feature.major;
+      maxMinor = feature.minor;
+    }
+  }
+
+  const std::map<std::string, std::string> sections = generateSections(api);
+  const std::map<std::string, std::string> values =
+  {
+    { "FUNCTION_COUNT", std::to_string(api.commands.size()) },
+    { "MAX_MAJOR", std::to_string(maxMajor) },
+    { "MAX_MINOR", std::to_string(maxMinor) }
+  };
+
+  for (int i = 3; i < argc; i += 2)
+  {
+    std::string input, output;
+    if (!readFile(argv[i], input))
+    {
+      std::cerr << "Failed to read " << argv[i] << std::endl;
+      return 1;
+    }
+
+    if (!expand(input, sections, values, output, error))
+    {
+      std::cerr << argv[i] << ": " << error << std::endl;
+      return 1;
+    }
+
+    std::ofstream file(argv[i + 1], std::ios::binary);
+    file << output;
+    if (!file)
+    {
+      std::cerr << "Failed to write " << argv[i + 1] << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,187 @@
+// Generates a copy of glad.c which only looks up the GL functions a program
+// references, for add_glad() in CMake.
+//
+//   glad_prune <output file> <glad.c> <object files>...
+//
+// The object files are searched for the names of glad's function pointers
+// (glad_gl...) and call counting wrappers (glad_counted_gl...). Object files
+// of every platform keep symbol names as plain text, including the symbol
+// tables of LTO objects, so no nm is needed. A name mentioned anywhere counts
+// as referenced, which at worst keeps a function that is not called.
+//
+// The pointers of the other functions are still defined, and stay NULL. The
+// version and extension flags are still all set, and the functions which
+// glad calls itself, to find them and to trace calls, are always kept.
+// The per-context tables of GLAD_MULTI_CONTEXT are left as they are, since
+// calls through them do not name any symbol.
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  const char* const alwaysKept[] =
+  {
+    "glGetString", "glGetStringi", "glGetIntegerv", "glGetBufferParameteriv"
+  };
+
+  bool readFile(const std::string& path, std::string& contents)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    contents.assign(
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+  }
+
+  bool isNameChar(char c)
+  {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+  }
+
+  // Add the GL function of each name with the prefix in the data.
+  void findReferences(
+    const std::string& data,
+    const std::string& prefix,
+    std::set<std::string>& names)
+  {
+    std::size_t pos = data.find(prefix);
+    while (pos != std::string::npos)
+    {
+      const std::size_t start = pos + prefix.size() - 2;
+      std::size_t end = start + 2;
+      while (end < data.size() && isNameChar(data[end])) end++;
+
+      names.insert(data.substr(start, end - start));
+      pos = data.find(prefix, end);
+    }
+  }
+
+  // The function a line of glad.c belongs to, if it is one to prune:
+  //   glad_glX = (PFNGLXPROC)load("glX");   (eager loading)
+  //   glad_glX = lazy_glX;                  (lazy loading)
+  //   if(glad_glX == lazy_glX) ...          (starting or ending a trace)
+  //   static ... APIENTRY lazy_glX(...) {   (a trampoline, up to "}")
+  //   ... APIENTRY glad_counted_glX(...) {  (a counting wrapper, up to "}")
+  //   static ... APIENTRY trace_glX(...) {  (a tracing wrapper, up to "}")
+  // These are the generated lines indented by one tab which name a function
+  // pointer (not glad_gl_context), and wholeFunction is set for the lines
+  // which start a function.
+  std::string functionOf(const std::string& line, bool& wholeFunction)
+  {
+    wholeFunction = false;
+
+    std::size_t start;
+    if (line.compare(0, 1, "\t") == 0 && line.compare(0, 2, "\t\t") != 0 &&
+        (start = line.find("glad_gl")) != line.npos &&
+        std::isupper(static_cast<unsigned char>(line[start + 7])))
+    {
+      start += 5;
+    }
+    else if ((start = line.find(" APIENTRY lazy_")) != line.npos)
+    {
+      start += 15;
+      wholeFunction = true;
+    }
+    else if ((start = line.find(" APIENTRY glad_counted_")) != line.npos)
+    {
+      start += 23;
+      wholeFunction = true;
+    }
+    else if ((start = line.find(" APIENTRY trace_")) != line.npos)
+    {
+      start += 16;
+      wholeFunction = true;
+    }
+    else
+    {
+      return "";
+    }
+
+    std::size_t end = start;
+    while (end < line.size() && isNameChar(line[end])) end++;
+    return line.substr(start, end - start);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 3)
+  {
+    std::cerr << "Usage: glad_prune <output file> <glad.c> <object files>..."
+              << std::endl;
+    return 2;
+  }
+
+  std::string glad;
+  if (!readFile(argv[2], glad))
+  {
+    std::cerr << "Failed to read " << argv[2] << std::endl;
+    return 1;
+  }
+
+  std::set<std::string> referenced(
+    std::begin(alwaysKept), std::end(alwaysKept));
+  for (int i = 3; i < argc; i++)
+  {
+    std::string data;
+    if (!readFile(argv[i], data))
+    {
+      std::cerr << "Failed to read object file " << argv[i] << std::endl;
+      return 1;
+    }
+
+    findReferences(data, "glad_gl", referenced);
+    findReferences(data, "glad_counted_gl", referenced);
+  }
+
+  std::istringstream lines(glad);
+  std::ostringstream pruned;
+  std::set<std::string> loaded, all;
+  std::string line;
+  bool skipping = false;
+  while (std::getline(lines, line))
+  {
+    if (skipping)
+    {
+      skipping = line != "}";
+      continue;
+    }
+
+    bool wholeFunction;
+    const std::string function = functionOf(line, wholeFunction);
+    if (!function.empty() && function.compare(0, 2, "gl") == 0)
+    {
+      all.insert(function);
+      if (referenced.count(function) == 0)
+      {
+        skipping = wholeFunction;
+        continue;
+      }
+
+      loaded.insert(function);
+    }
+
+    pruned << line << '\n';
+  }
+
+  std::ofstream output(argv[1], std::ios::binary);
+  output << "/* Pruned by glad_prune to the " << loaded.size() << " of "
+         << all.size() << " functions which the program references. */\n"
+         << pruned.str();
+
+  if (!output)
+  {
+    std::cerr << "Failed to write " << argv[1] << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,744 @@
+// Generates C++ descriptions of GLSL shader interfaces, for reflect_shaders()
+// in CMake.
+//
+//   glsl_reflect <output header> <shader files>...
+//
+// Only declarations outside functions are read: uniforms, std140 uniform
+// blocks and, in vertex shaders (.vs), inputs. Preprocessor directives are
+// skipped, so declarations which come from #include or depend on #ifdef are
+// not seen. Nothing here needs a GL context.
+
+#include "std140.h"
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  struct Token
+  {
+    std::string text;
+    int line;
+  };
+
+  struct GlslType
+  {
+    const char* name;
+    const char* glEnum;
+
+    // The type a Uniform<T> handle holds, or nullptr if there is none.
+    const char* cppType;
+
+    // Whether the type can be a std140 block member, and as what.
+    bool inBlocks;
+    std140::Type blockType;
+  };
+
+  const GlslType glslTypes[] =
+  {
+    { "float", "GL_FLOAT", "float", true, std140::Type::Float },
+    { "int", "GL_INT", "int", true, std140::Type::Int },
+    { "uint", "GL_UNSIGNED_INT", "unsigned int", true, std140::Type::UInt },
+    { "bool", "GL_BOOL", "bool", true, std140::Type::Bool },
+    { "vec2", "GL_FLOAT_VEC2", "glsl::vec2", true, std140::Type::Vec2 },
+    { "vec3", "GL_FLOAT_VEC3", "glsl::vec3", true, std140::Type::Vec3 },
+    { "vec4", "GL_FLOAT_VEC4", "glsl::vec4", true, std140::Type::Vec4 },
+    { "ivec2", "GL_INT_VEC2", "glsl::ivec2", true, std140::Type::IVec2 },
+    { "ivec3", "GL_INT_VEC3", "glsl::ivec3", true, std140::Type::IVec3 },
+    { "ivec4", "GL_INT_VEC4", "glsl::ivec4", true, std140::Type::IVec4 },
+    { "uvec2", "GL_UNSIGNED_INT_VEC2", nullptr, false, {} },
+    { "uvec3", "GL_UNSIGNED_INT_VEC3", nullptr, false, {} },
+    { "uvec4", "GL_UNSIGNED_INT_VEC4", nullptr, false, {} },
+    { "bvec2", "GL_BOOL_VEC2", nullptr, false, {} },
+    { "bvec3", "GL_BOOL_VEC3", nullptr, false, {} },
+    { "bvec4", "GL_BOOL_VEC4", nullptr, false, {} },
+    { "mat2", "GL_FLOAT_MAT2", nullptr, false, {} },
+    { "mat3", "GL_FLOAT_MAT3", "glsl::mat3", true, std140::Type::Mat3 },
+    { "mat4", "GL_FLOAT_MAT4", "glsl::mat4", true, std140::Type::Mat4 },
+    { "sampler1D", "GL_SAMPLER_1D", "int", false, {} },
+    { "sampler2D", "GL_SAMPLER_2D", "int", false, {} },
+    { "sampler3D", "GL_SAMPLER_3D", "int", false, {} },
+    { "samplerCube", "GL_SAMPLER_CUBE", "int", false, {} },
+    { "sampler2DArray", "GL_SAMPLER_2D_ARRAY", "int", false, {} },
+    { "sampler2DShadow", "GL_SAMPLER_2D_SHADOW", "int", false, {} },
+    { "sampler2DMS", "GL_SAMPLER_2D_MULTISAMPLE", "int", false, {} },
+    { "isampler2D", "GL_INT_SAMPLER_2D", "int", false, {} },
+    { "usampler2D", "GL_UNSIGNED_INT_SAMPLER_2D", "int", false, {} }
+  };
+
+  // Qualifiers which make no difference to the interface.
+  const char* const ignoredQualifiers[] =
+  {
+    "const", "flat", "smooth", "noperspective", "centroid", "invariant",
+    "lowp", "mediump", "highp", "precise"
+  };
+
+  const char* const cppKeywords[] =
+  {
+    "auto", "case", "catch", "char", "class", "default", "delete", "double",
+    "enum", "explicit", "export", "extern", "friend", "goto", "long",
+    "mutable", "namespace", "new", "operator", "private", "protected",
+    "public", "register", "short", "signed", "sizeof", "static", "template",
+    "this", "throw", "try", "typedef", "typename", "union", "unsigned",
+    "using", "virtual", "volatile", "wchar_t"
+  };
+
+  struct Variable
+  {
+    std::string name;
+    const GlslType* type;
+
+    // The array length, or 0 for a single value.
+    unsigned count;
+
+    // Inputs only: from the layout qualifier, or -1.
+    int location;
+  };
+
+  struct Block
+  {
+    std::string name;
+    std140::Layout layout;
+  };
+
+  struct Shader
+  {
+    std::string path;
+    std::string identifier;
+    std::vector<Variable> uniforms;
+    std::vector<Variable> inputs;
+    std::vector<Block> blocks;
+  };
+
+  // Thrown after a message has been printed.
+  struct ParseError {};
+
+  class Parser
+  {
+  public:
+    Parser(Shader& shader, bool vertexShader) :
+      shader(shader),
+      vertexShader(vertexShader)
+    {
+    }
+
+    void parse(const std::string& source);
+
+  private:
+    Shader& shader;
+    bool vertexShader;
+    std::vector<Token> tokens;
+
+    void tokenize(const std::string& source);
+
+    std::size_t skipBraces(std::size_t open) const;
+    std::size_t block(const std::vector<Token>& head, std::size_t open);
+    void declaration(const std::vector<Token>& statement);
+
+    // Read the names (with array lengths) declared by a statement, starting
+    // at the given token.
+    std::vector<std::pair<std::string, unsigned>> names(
+      const std::vector<Token>& statement,
+      std::size_t first) const;
+
+    // Read a layout qualifier starting at the given token, returning the
+    // index of the token after it.
+    std::size_t layout(
+      const std::vector<Token>& statement,
+      std::size_t first,
+      std::vector<std::pair<std::string, std::string>>& qualifiers) const;
+
+    [[noreturn]] void fail(int line, const std::string& message) const;
+  };
+
+  bool contains(const char* const* begin, const char* const* end,
+    const std::string& text)
+  {
+    for (auto word = begin; word != end; ++word)
+    {
+      if (text == *word) return true;
+    }
+
+    return false;
+  }
+
+  const GlslType* findType(const std::string& name)
+  {
+    for (const GlslType& type : glslTypes)
+    {
+      if (name == type.name) return &type;
+    }
+
+    return nullptr;
+  }
+
+  bool isIdentifier(const std::string& text)
+  {
+    return !text.empty()
+      && (std::isalpha(static_cast<unsigned char>(text[0])) || text[0] == '_');
+  }
+
+  // The file name with everything but letters and digits replaced, as CMake's
+  // string(MAKE_C_IDENTIFIER) does (vertexShader.vs -> vertexShader_vs).
+  std::string makeIdentifier(const std::string& path)
+  {
+    std::string name = path.substr(path.find_last_of("/\\") + 1);
+    for (char& c : name)
+    {
+      if (!std::isalnum(static_cast<unsigned char>(c))) c = '_';
+    }
+
+    if (!name.empty() && std::isdigit(static_cast<unsigned char>(name[0])))
+    {
+      name.insert(0, "_");
+    }
+
+    return name;
+  }
+
+  std::string memberName(const std::string& name)
+  {
+    return contains(std::begin(cppKeywords), std::end(cppKeywords), name)
+      ? name + "_" : name;
+  }
+}
+
+void Parser::parse(const std::string& source)
+{
+  tokenize(source);
+
+  std::vector<Token> statement;
+  for (std::size_t i = 0; i < tokens.size(); i++)
+  {
+    const std::string& text = tokens[i].text;
+    if (text == ";")
+    {
+      declaration(statement);
+      statement.clear();
+    }
+    else if (text == "{")
+    {
+      bool uniformBlock = false;
+      for (const Token& token : statement)
+      {
+        if (token.text == "uniform") uniformBlock = true;
+      }
+
+      // Anything else with braces is a function or a structure.
+      i = uniformBlock ? block(statement, i) : skipBraces(i);
+      statement.clear();
+    }
+    else
+    {
+      statement.push_back(tokens[i]);
+    }
+  }
+}
+
+void Parser::tokenize(const std::string& source)
+{
+  int line = 1;
+  bool lineStart = true;
+  std::size_t i = 0;
+  while (i < source.size())
+  {
+    const char c = source[i];
+    if (c == '\n')
+    {
+      line++;
+      lineStart = true;
+      i++;
+    }
+    else if (std::isspace(static_cast<unsigned char>(c)))
+    {
+      i++;
+    }
+    else if (source.compare(i, 2, "//") == 0)
+    {
+      i = source.find('\n', i);
+      if (i == std::string::npos) i = source.size();
+    }
+    else if (source.compare(i, 2, "/*") == 0)
+    {
+      std::size_t end = source.find("*/", i + 2);
+      end = end == std::string::npos ? source.size() : end + 2;
+      for (; i < end; i++)
+      {
+        if (source[i] == '\n') line++;
+      }
+    }
+    else if (c == '#' && lineStart)
+    {
+      // Skip the directive, including any continuation lines.
+      while (i < source.size() && source[i] != '\n')
+      {
+        if (source[i] == '\\' && i + 1 < source.size()
+         && source[i + 1] == '\n')
+        {
+          line++;
+          i++;
+        }
+
+        i++;
+      }
+    }
+    else if (std::isalnum(static_cast<unsigned char>(c)) || c == '_')
+    {
+      std::size_t end = i;
+      while (end < source.size()
+        && (std::isalnum(static_cast<unsigned char>(source[end]))
+         || source[end] == '_' || source[end] == '.'))
+      {
+        // Dots only belong to numbers.
+        if (source[end] == '.' && !std::isdigit(static_cast<unsigned char>(c)))
+        {
+          break;
+        }
+
+        end++;
+      }
+
+      tokens.push_back({ source.substr(i, end - i), line });
+      lineStart = false;
+      i = end;
+    }
+    else
+    {
+      tokens.push_back({ std::string(1, c), line });
+      lineStart = false;
+      i++;
+    }
+  }
+}
+
+std::size_t Parser::skipBraces(std::size_t open) const
+{
+  int depth = 0;
+  for (std::size_t i = open; i < tokens.size(); i++)
+  {
+    if (tokens[i].text == "{") depth++;
+    if (tokens[i].text == "}" && --depth == 0) return i;
+  }
+
+  fail(tokens[open].line, "unmatched {");
+}
+
+std::size_t Parser::block(const std::vector<Token>& head, std::size_t open)
+{
+  std::vector<std::pair<std::string, std::string>> qualifiers;
+  std::size_t first = 0;
+  if (!head.empty() && head[0].text == "layout")
+  {
+    first = layout(head, 0, qualifiers);
+  }
+
+  bool std140Layout = false;
+  for (const auto& qualifier : qualifiers)
+  {
+    if (qualifier.first == "std140") std140Layout = true;
+  }
+
+  const int line = tokens[open].line;
+  if (!std140Layout)
+  {
+    fail(line, "only std140 uniform blocks are supported");
+  }
+
+  if (head.size() != first + 2 || head[first].text != "uniform"
+   || !isIdentifier(head[first + 1].text))
+  {
+    fail(line, "malformed uniform block");
+  }
+
+  Block result{ head[first + 1].text, {} };
+
+  std::vector<Token> statement;
+  std::size_t i = open + 1;
+  for (; i < tokens.size() && tokens[i].text != "}"; i++)
+  {
+    if (tokens[i].text != ";")
+    {
+      statement.push_back(tokens[i]);
+      continue;
+    }
+
+    std::size_t typeIndex = 0;
+    while (typeIndex < statement.size()
+      && contains(std::begin(ignoredQualifiers), std::end(ignoredQualifiers),
+        statement[typeIndex].text))
+    {
+      typeIndex++;
+    }
+
+    if (typeIndex >= statement.size()) fail(tokens[i].line, "expected a type");
+
+    const GlslType* type = findType(statement[typeIndex].text);
+    if (type == nullptr || !type->inBlocks)
+    {
+      fail(statement[typeIndex].line, "unsupported uniform block member type "
+        + statement[typeIndex].text);
+    }
+
+    for (const auto& name : names(statement, typeIndex + 1))
+    {
+      result.layout.add(name.first, type->blockType, name.second);
+    }
+
+    statement.clear();
+  }
+
+  if (i >= tokens.size()) fail(line, "unterminated uniform block");
+
+  // Skip the instance name, if there is one.
+  while (i < tokens.size() && tokens[i].text != ";") i++;
+
+  shader.blocks.push_back(std::move(result));
+  return i;
+}
+
+void Parser::declaration(const std::vector<Token>& statement)
+{
+  std::vector<std::pair<std::string, std::string>> qualifiers;
+  std::size_t i = 0;
+  while (i < statement.size())
+  {
+    if (statement[i].text == "layout")
+    {
+      i = layout(statement, i, qualifiers);
+    }
+    else if (contains(std::begin(ignoredQualifiers),
+      std::end(ignoredQualifiers), statement[i].text))
+    {
+      i++;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  if (i + 1 >= statement.size()) return;
+
+  const std::string& storage = statement[i].text;
+  const bool uniform = storage == "uniform";
+  const bool input = vertexShader && (storage == "in" || storage == "attribute");
+  if (!uniform && !input) return;
+
+  const Token& typeToken = statement[i + 1];
+  const GlslType* type = findType(typeToken.text);
+  if (type == nullptr)
+  {
+    std::cerr << shader.path << ":" << typeToken.line << ": warning: "
+              << typeToken.text << " is not a supported type, skipped"
+              << std::endl;
+    return;
+  }
+
+  int location = -1;
+  for (const auto& qualifier : qualifiers)
+  {
+    if (qualifier.first == "location") location = std::stoi(qualifier.second);
+  }
+
+  for (const auto& name : names(statement, i + 2))
+  {
+    Variable variable{ name.first, type, name.second, location };
+    if (uniform)
+    {
+      shader.uniforms.push_back(variable);
+    }
+    else
+    {
+      shader.inputs.push_back(variable);
+      if (location >= 0) location++;
+    }
+  }
+}
+
+std::vector<std::pair<std::string, unsigned>> Parser::names(
+  const std::vector<Token>& statement,
+  std::size_t first) const
+{
+  std::vector<std::pair<std::string, unsigned>> result;
+  std::size_t i = first;
+  while (i < statement.size())
+  {
+    const Token& name = statement[i];
+    if (!isIdentifier(name.text)) fail(name.line, "expected a name");
+    i++;
+
+    unsigned count = 0;
+    if (i < statement.size() && statement[i].text == "[")
+    {
+      if (i + 2 >= statement.size() || statement[i + 2].text != "]"
+       || !std::isdigit(static_cast<unsigned char>(statement[i + 1].text[0])))
+      {
+        fail(name.line, "array lengths must be integer literals");
+      }
+
+      count = unsigned(std::stoul(statement[i + 1].text));
+      i += 3;
+    }
+
+    result.emplace_back(name.text, count);
+
+    // Skip any initializer.
+    int depth = 0;
+    while (i < statement.size() && (depth > 0 || statement[i].text != ","))
+    {
+      if (statement[i].text == "(") depth++;
+      if (statement[i].text == ")") depth--;
+      i++;
+    }
+
+    if (i < statement.size()) i++;
+  }
+
+  return result;
+}
+
+std::size_t Parser::layout(
+  const std::vector<Token>& statement,
+  std::size_t first,
+  std::vector<std::pair<std::string, std::string>>& qualifiers) const
+{
+  std::size_t i = first + 1;
+  if (i >= statement.size() || statement[i].text != "(")
+  {
+    fail(statement[first].line, "expected ( after layout");
+  }
+
+  for (i++; i < statement.size() && statement[i].text != ")"; i++)
+  {
+    if (!isIdentifier(statement[i].text)) continue;
+
+    std::string value;
+    if (i + 2 < statement.size() && statement[i + 1].text == "=")
+    {
+      value = statement[i + 2].text;
+    }
+
+    qualifiers.emplace_back(statement[i].text, value);
+    if (!value.empty()) i += 2;
+  }
+
+  if (i >= statement.size()) fail(statement[first].line, "unterminated layout");
+  return i + 1;
+}
+
+void Parser::fail(int line, const std::string& message) const
+{
+  std::cerr << shader.path << ":" << line << ": error: " << message
+            << std::endl;
+  throw ParseError();
+}
+
+namespace
+{
+  const char* enumeratorName(std140::Type type)
+  {
+    switch (type)
+    {
+      case std140::Type::Float: return "std140::Type::Float";
+      case std140::Type::Int: return "std140::Type::Int";
+      case std140::Type::UInt: return "std140::Type::UInt";
+      case std140::Type::Bool: return "std140::Type::Bool";
+      case std140::Type::Vec2: return "std140::Type::Vec2";
+      case std140::Type::Vec3: return "std140::Type::Vec3";
+      case std140::Type::Vec4: return "std140::Type::Vec4";
+      case std140::Type::IVec2: return "std140::Type::IVec2";
+      case std140::Type::IVec3: return "std140::Type::IVec3";
+      case std140::Type::IVec4: return "std140::Type::IVec4";
+      case std140::Type::Mat3: return "std140::Type::Mat3";
+      case std140::Type::Mat4: return "std140::Type::Mat4";
+    }
+
+    return "";
+  }
+
+  void writeShader(std::ostream& out, const Shader& shader)
+  {
+    out << "  // " << shader.path << "\n"
+        << "  namespace " << shader.identifier << "\n  {\n";
+
+    out << "    constexpr std::array<ReflectedUniform, "
+        << shader.uniforms.size() << "> uniforms =\n    {{\n";
+    for (const Variable& uniform : shader.uniforms)
+    {
+      out << "      { \"" << uniform.name << "\", hashName(\"" << uniform.name
+          << "\"), " << uniform.type->glEnum << ", " << uniform.count
+          << " },\n";
+    }
+
+    out << "    }};\n\n";
+
+    out << "    constexpr std::array<ReflectedAttribute, "
+        << shader.inputs.size() << "> attributes =\n    {{\n";
+    for (const Variable& input : shader.inputs)
+    {
+      out << "      { \"" << input.name << "\", " << input.type->glEnum << ", "
+          << input.location << " },\n";
+    }
+
+    out << "    }};\n\n";
+
+    for (const Block& block : shader.blocks)
+    {
+      const std::vector<std140::Member>& members = block.layout.members();
+      out << "    constexpr std::array<ReflectedBlockMember, "
+          << members.size() << "> " << block.name << "Members =\n    {{\n";
+      for (const std140::Member& member : members)
+      {
+        out << "      { \"" << member.name << "\", "
+            << enumeratorName(member.type);
+        out << ", " << member.count << ", " << member.offset << " },\n";
+      }
+
+      out << "    }};\n\n"
+          << "    constexpr ReflectedBlock " << block.name << " =\n    {\n"
+          << "      \"" << block.name << "\",\n"
+          << "      " << block.layout.size() << ",\n"
+          << "      " << block.name << "Members.data(),\n"
+          << "      " << block.name << "Members.size()\n"
+          << "    };\n\n";
+    }
+
+    out << "    // Handles to the uniforms of a program built from this "
+           "shader.\n"
+        << "    struct Binder\n    {\n"
+        << "      explicit Binder(Shader& shader)";
+
+    std::vector<std::size_t> bound;
+    for (std::size_t i = 0; i < shader.uniforms.size(); i++)
+    {
+      const Variable& uniform = shader.uniforms[i];
+      if (uniform.type->cppType != nullptr && uniform.count == 0)
+      {
+        bound.push_back(i);
+      }
+    }
+
+    if (bound.empty())
+    {
+      out << "\n      {\n        (void)shader;\n      }\n";
+    }
+    else
+    {
+      for (std::size_t i = 0; i < bound.size(); i++)
+      {
+        const std::size_t index = bound[i];
+        out << (i == 0 ? " :\n" : ",\n")
+            << "        " << memberName(shader.uniforms[index].name)
+            << "(shader, std::string(uniforms[" << index << "].name), "
+            << "uniforms[" << index << "].hash)";
+      }
+
+      out << "\n      {\n      }\n";
+    }
+
+    if (!shader.uniforms.empty()) out << "\n";
+    for (const Variable& uniform : shader.uniforms)
+    {
+      if (uniform.type->cppType == nullptr || uniform.count > 0)
+      {
+        out << "      // No handle for " << uniform.type->name << " "
+            << uniform.name;
+        if (uniform.count > 0) out << "[" << uniform.count << "]";
+        out << ".\n";
+        continue;
+      }
+
+      out << "      Uniform<" << uniform.type->cppType << "> "
+          << memberName(uniform.name) << ";\n";
+    }
+
+    out << "    };\n  }\n";
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 3)
+  {
+    std::cerr << "Usage: glsl_reflect <output header> <shader files>..."
+              << std::endl;
+    return 2;
+  }
+
+  std::vector<Shader> shaders;
+  for (int i = 2; i < argc; i++)
+  {
+    std::ifstream file(argv[i]);
+    if (!file)
+    {
+      std::cerr << "Failed to read shader file " << argv[i] << std::endl;
+      return 1;
+    }
+
+    std::stringstream source;
+    source << file.rdbuf();
+
+    Shader shader;
+    shader.path = argv[i];
+    shader.identifier = makeIdentifier(shader.path);
+
+    const std::string path = shader.path;
+    const bool vertexShader =
+      path.size() > 3 && path.compare(path.size() - 3, 3, ".vs") == 0;
+
+    try
+    {
+      Parser(shader, vertexShader).parse(source.str());
+    }
+    catch (const ParseError&)
+    {
+      return 1;
+    }
+
+    shaders.push_back(std::move(shader));
+  }
+
+  std::ostringstream out;
+  out << "// Generated by glsl_reflect from the files below. Do not edit.\n"
+      << "#ifndef __OPENGL_TUTORIAL_REFLECTED_SHADERS_H__\n"
+      << "#define __OPENGL_TUTORIAL_REFLECTED_SHADERS_H__\n\n"
+      << "#include \"glsl_types.h\"\n"
+      << "#include \"shader.h\"\n"
+      << "#include \"shader_reflection.h\"\n"
+      << "#include \"uniform.h\"\n"
+      << "#include \"uniform_table.h\"\n"
+      << "#include <array>\n"
+      << "#include <string>\n\n"
+      << "namespace reflected\n{\n";
+
+  for (std::size_t i = 0; i < shaders.size(); i++)
+  {
+    if (i > 0) out << "\n";
+    writeShader(out, shaders[i]);
+  }
+
+  out << "}\n\n#endif // __OPENGL_TUTORIAL_REFLECTED_SHADERS_H__\n";
+
+  // Only touch the header when it changes, to avoid needless rebuilds.
+  const std::string header = out.str();
+  {
+    std::ifstream existing(argv[1], std::ios::binary);
+    std::stringstream current;
+    current << existing.rdbuf();
+    if (existing && current.str() == header) return 0;
+  }
+
+  std::ofstream output(argv[1], std::ios::binary);
+  if (!(output << header))
+  {
+    std::cerr << "Failed to write " << argv[1] << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,224 @@
+#ifndef __OPENGL_TUTORIAL_UNIFORM_H__
+#define __OPENGL_TUTORIAL_UNIFORM_H__
+
+#include "glad/glad.h"
+#include "glsl_types.h"
+#include "shader.h"
+#include "uniform_table.h"
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// The GLSL type reported by glGetActiveUniform for each C++ value type.
+template <typename T>
+constexpr GLenum glslTypeOf()
+{
+  if constexpr (std::is_same_v<T, float>) return GL_FLOAT;
+  else if constexpr (std::is_same_v<T, int>) return GL_INT;
+  else if constexpr (std::is_same_v<T, unsigned int>) return GL_UNSIGNED_INT;
+  else if constexpr (std::is_same_v<T, bool>) return GL_BOOL;
+  else if constexpr (std::is_same_v<T, glsl::vec2>) return GL_FLOAT_VEC2;
+  else if constexpr (std::is_same_v<T, glsl::vec3>) return GL_FLOAT_VEC3;
+  else if constexpr (std::is_same_v<T, glsl::vec4>) return GL_FLOAT_VEC4;
+  else if constexpr (std::is_same_v<T, glsl::ivec2>) return GL_INT_VEC2;
+  else if constexpr (std::is_same_v<T, glsl::ivec3>) return GL_INT_VEC3;
+  else if constexpr (std::is_same_v<T, glsl::ivec4>) return GL_INT_VEC4;
+  else if constexpr (std::is_same_v<T, glsl::mat3>) return GL_FLOAT_MAT3;
+  else
+  {
+    static_assert(std::is_same_v<T, glsl::mat4>, "Not a uniform type");
+    return GL_FLOAT_MAT4;
+  }
+}
+
+// A handle to one uniform of a shader, holding values of type T.
+// The name is looked up and the GLSL type checked once, when the handle is
+// created (prints a message and throws on a mismatch). Setting a value the
+// program already has makes no GL call. The handle follows the shader if its
+// program is replaced, for example by ShaderWatcher: if the new program
+// declares the uniform with another type, a message is printed and setting it
+// does nothing, as for a uniform the program does not have.
+// As with glUniform*, the shader must be in use when a value is set.
+//
+// The handle points at the Shader, so the Shader must outlive it and must not
+// be moved while it exists.
+//
+// A handle constructed directly, as here, only has its type checked at run
+// time, when it is created: T is whatever the caller says. Only the handles
+// of the Binder structs generated by reflect_shaders() have their T taken
+// from the GLSL source, so that a mismatch fails to compile.
+template <typename T>
+class Uniform
+{
+public:
+  Uniform(Shader& shader, std::string name);
+
+  // The same, with the hash of the name already computed (for example by
+  // hashName() at compile time).
+  Uniform(Shader& shader, std::string name, std::uint32_t nameHash);
+
+  void set(const T& value);
+
+  Uniform& operator=(const T& value)
+  {
+    set(value);
+    return *this;
+  }
+
+  // The location in the current program (-1 if it has no such uniform).
+  int location() const { return uniformLocation; }
+
+private:
+  Shader* shader;
+  std::string name;
+  std::uint32_t nameHash;
+
+  // The generation of the shader's program the location was looked up in.
+  std::uint64_t generation;
+  int uniformLocation;
+
+  // Look the uniform up in the shader's current program. A type mismatch
+  // throws if strict, and otherwise leaves the handle unbound.
+  void resolve(bool strict);
+  static bool compatible(GLenum type);
+  static void upload(int location, const T& value);
+};
+
+template <typename T>
+Uniform<T>::Uniform(Shader& shader, std::string name) :
+  Uniform(shader, name, hashName(name))
+{
+}
+
+template <typename T>
+Uniform<T>::Uniform(
+  Shader& shader,
+  std::string name,
+  std::uint32_t nameHash) :
+  shader(&shader),
+  name(std::move(name)),
+  nameHash(nameHash),
+  generation(0),
+  uniformLocation(-1)
+{
+  resolve(true);
+}
+
+template <typename T>
+void Uniform<T>::set(const T& value)
+{
+  if (shader->generation() != generation) resolve(false);
+  if (uniformLocation < 0) return;
+
+  // Bools are stored as ints, so that they compare the same as setBool().
+  if constexpr (std::is_same_v<T, bool>)
+  {
+    int stored = value ? 1 : 0;
+    if (!shader->shadow(uniformLocation, &stored, sizeof(stored)))
+    {
+      return;
+    }
+  }
+  else if (!shader->shadow(uniformLocation, &value, sizeof(T)))
+  {
+    return;
+  }
+
+  upload(uniformLocation, value);
+}
+
+template <typename T>
+void Uniform<T>::resolve(bool strict)
+{
+  generation = shader->generation();
+  uniformLocation = -1;
+
+  // Like glGetUniformLocation, a uniform the program does not use is not an
+  // error: setting it does nothing.
+  const UniformInfo* info = shader->uniformInfo(name, nameHash);
+  if (info == nullptr) return;
+
+  if (info->size != 1 || !compatible(info->type))
+  {
+    std::cout << "Uniform " << name << " has a different type in the program"
+              << " than the handle" << std::endl;
+
+    // A reloaded program must not take down the render loop.
+    if (strict) throw std::exception();
+    return;
+  }
+
+  uniformLocation = info->location;
+}
+
+template <typename T>
+bool Uniform<T>::compatible(GLenum type)
+{
+  if (type == glslTypeOf<T>()) return true;
+
+  // Samplers are set with glUniform1i.
+  if constexpr (std::is_same_v<T, int>)
+  {
+    switch (type)
+    {
+      case GL_SAMPLER_1D: case GL_SAMPLER_2D: case GL_SAMPLER_3D:
+      case GL_SAMPLER_CUBE: case GL_SAMPLER_2D_ARRAY:
+      case GL_SAMPLER_2D_SHADOW: case GL_SAMPLER_2D_MULTISAMPLE:
+      case GL_INT_SAMPLER_2D: case GL_UNSIGNED_INT_SAMPLER_2D:
+        return true;
+    }
+  }
+
+  return false;
+}
+
+template <typename T>
+void Uniform<T>::upload(int location, const T& value)
+{
+  if constexpr (std::is_same_v<T, float>) glUniform1f(location, value);
+  else if constexpr (std::is_same_v<T, int>) glUniform1i(location, value);
+  else if constexpr (std::is_same_v<T, unsigned int>)
+  {
+    glUniform1ui(location, value);
+  }
+  else if constexpr (std::is_same_v<T, bool>)
+  {
+    glUniform1i(location, value ? 1 : 0);
+  }
+  else if constexpr (std::is_same_v<T, glsl::vec2>)
+  {
+    glUniform2f(location, value.x, value.y);
+  }
+  else if constexpr (std::is_same_v<T, glsl::vec3>)
+  {
+    glUniform3f(location, value.x, value.y, value.z);
+  }
+  else if constexpr (std::is_same_v<T, glsl::vec4>)
+  {
+    glUniform4f(location, value.x, value.y, value.z, value.w);
+  }
+  else if constexpr (std::is_same_v<T, glsl::ivec2>)
+  {
+    glUniform2i(location, value.x, value.y);
+  }
+  else if constexpr (std::is_same_v<T, glsl::ivec3>)
+  {
+    glUniform3i(location, value.x, value.y, value.z);
+  }
+  else if constexpr (std::is_same_v<T, glsl::ivec4>)
+  {
+    glUniform4i(location, value.x, value.y, value.z, value.w);
+  }
+  else if constexpr (std::is_same_v<T, glsl::mat3>)
+  {
+    glUniformMatrix3fv(location, 1, GL_FALSE, value.m);
+  }
+  else
+  {
+    glUniformMatrix4fv(location, 1, GL_FALSE, value.m);
+  }
+}
+
+#endif // __OPENGL_TUTORIAL_UNIFORM_H__
@@ -0,0 +1,216 @@
+#include "uniform_block.h"
+
+UniformBlock::UniformBlock(
+  std::string name,
+  std140::Layout layout,
+  unsigned int binding) :
+  name(std::move(name)),
+  layout(std::move(layout)),
+  binding(binding),
+  bufferID(0),
+  data(this->layout.size(), 0),
+  dirtyBegin(0),
+  dirtyEnd(0)
+{
+  glGenBuffers(1, &bufferID);
+  glBindBuffer(GL_UNIFORM_BUFFER, bufferID);
+  glBufferData(GL_UNIFORM_BUFFER, data.size(), data.data(), GL_DYNAMIC_DRAW);
+  glBindBufferBase(GL_UNIFORM_BUFFER, binding, bufferID);
+}
+
+UniformBlock::~UniformBlock()
+{
+  if (bufferID != 0) glDeleteBuffers(1, &bufferID);
+}
+
+void UniformBlock::bind(unsigned int program) const
+{
+  unsigned int index = glGetUniformBlockIndex(program, name.c_str());
+  if (index == GL_INVALID_INDEX) return;
+
+  // A member missing from either side changes the size, so this catches
+  // those before the members are compared.
+  int dataSize = 0;
+  glGetActiveUniformBlockiv(
+    program, index, GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+  if (dataSize != int(layout.size()))
+  {
+    std::cout << "Uniform block " << name << " is " << dataSize
+              << " bytes in the program but " << layout.size()
+              << " bytes in the std140 layout" << std::endl;
+    throw std::exception();
+  }
+
+  int memberCount = 0;
+  glGetActiveUniformBlockiv(
+    program, index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &memberCount);
+  std::vector<int> memberIndices(memberCount);
+  if (memberCount > 0)
+  {
+    glGetActiveUniformBlockiv(
+      program,
+      index,
+      GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES,
+      memberIndices.data());
+  }
+
+  for (int memberIndex : memberIndices)
+  {
+    const unsigned int uniformIndex = memberIndex;
+
+    // Members of a block with an instance name are reported as
+    // "Block.member", and arrays as "member[0]".
+    char buffer[256];
+    int length = 0;
+    glGetActiveUniformName(
+      program, uniformIndex, sizeof(buffer), &length, buffer);
+    std::string memberName(buffer, length);
+    if (memberName.compare(0, name.size() + 1, name + ".") == 0)
+    {
+      memberName.erase(0, name.size() + 1);
+    }
+    if (memberName.size() > 3 &&
+        memberName.compare(memberName.size() - 3, 3, "[0]") == 0)
+    {
+      memberName.erase(memberName.size() - 3);
+    }
+
+    auto member = std::find_if(
+      layout.members().begin(),
+      layout.members().end(),
+      [&](const std140::Member& m) { return m.name == memberName; });
+    if (member == layout.members().end())
+    {
+      std::cout << "Uniform block " << name << " has a member " << memberName
+                << " in the program which is not in the std140 layout"
+                << std::endl;
+      throw std::exception();
+    }
+
+    const int type = activeUniform(program, uniformIndex, GL_UNIFORM_TYPE);
+    if (GLenum(type) != glTypeOf(member->type))
+    {
+      std::cout << "Uniform block " << name << " member " << member->name
+                << " has type 0x" << std::hex << type << std::dec
+                << " in the program but is a "
+                << std140::glslName(member->type) << " in the std140 layout"
+                << std::endl;
+      throw std::exception();
+    }
+
+    // Everything else is a number which must be the same on both sides.
+    const struct
+    {
+      const char* what;
+      GLenum property;
+      int expected;
+    } checks[] =
+    {
+      { "offset", GL_UNIFORM_OFFSET, int(member->offset) },
+      { "array length", GL_UNIFORM_SIZE, int(std::max(member->count, 1u)) },
+      {
+        "array stride",
+        GL_UNIFORM_ARRAY_STRIDE,
+        member->count > 0 ? int(std140::arrayStride(member->type)) : 0
+      },
+      {
+        "matrix stride",
+        GL_UNIFORM_MATRIX_STRIDE,
+        std140::isMatrix(member->type) ? 16 : 0
+      },
+      { "row major flag", GL_UNIFORM_IS_ROW_MAJOR, 0 }
+    };
+
+    for (const auto& check : checks)
+    {
+      const int value = activeUniform(program, uniformIndex, check.property);
+      if (value != check.expected)
+      {
+        std::cout << "Uniform block " << name << " member " << member->name
+                  << " has " << check.what << " " << value
+                  << " in the program but " << check.expected
+                  << " in the std140 layout" << std::endl;
+        throw std::exception();
+      }
+    }
+  }
+
+  glUniformBlockBinding(program, index, binding);
+}
+
+UniformBlock::Member UniformBlock::member(std::string_view memberName) const
+{
+  for (const std140::Member& member : layout.members())
+  {
+    if (member.name == memberName)
+    {
+      return { member.offset, member.type, member.count };
+    }
+  }
+
+  std::cout << "Uniform block " << name << " has no member "
+            << memberName << std::endl;
+  throw std::exception();
+}
+
+void UniformBlock::upload()
+{
+  if (dirtyBegin >= dirtyEnd) return;
+
+  glBindBuffer(GL_UNIFORM_BUFFER, bufferID);
+  glBufferSubData(
+    GL_UNIFORM_BUFFER,
+    dirtyBegin,
+    dirtyEnd - dirtyBegin,
+    data.data() + dirtyBegin);
+
+  dirtyBegin = dirtyEnd = 0;
+}
+
+void UniformBlock::write(unsigned offset, const void* value, unsigned size)
+{
+  if (std::memcmp(&data[offset], value, size) == 0) return;
+
+  std::memcpy(&data[offset], value, size);
+  if (dirtyBegin >= dirtyEnd)
+  {
+    dirtyBegin = offset;
+    dirtyEnd = offset + size;
+  }
+  else
+  {
+    dirtyBegin = std::min(dirtyBegin, offset);
+    dirtyEnd = std::max(dirtyEnd, offset + size);
+  }
+}
+
+GLenum UniformBlock::glTypeOf(std140::Type type)
+{
+  switch (type)
+  {
+    case std140::Type::Float: return GL_FLOAT;
+    case std140::Type::Int: return GL_INT;
+    case std140::Type::UInt: return GL_UNSIGNED_INT;
+    case std140::Type::Bool: return GL_BOOL;
+    case std140::Type::Vec2: return GL_FLOAT_VEC2;
+    case std140::Type::Vec3: return GL_FLOAT_VEC3;
+    case std140::Type::Vec4: return GL_FLOAT_VEC4;
+    case std140::Type::IVec2: return GL_INT_VEC2;
+    case std140::Type::IVec3: return GL_INT_VEC3;
+    case std140::Type::IVec4: return GL_INT_VEC4;
+    case std140::Type::Mat3: return GL_FLOAT_MAT3;
+    case std140::Type::Mat4: return GL_FLOAT_MAT4;
+  }
+
+  return GL_NONE;
+}
+
+int UniformBlock::activeUniform(
+  unsigned int program,
+  unsigned int index,
+  GLenum property)
+{
+  int value = -1;
+  glGetActiveUniformsiv(program, 1, &index, property, &value);
+  return value;
+}
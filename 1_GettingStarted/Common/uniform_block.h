@@ -0,0 +1,328 @@
+#ifndef __OPENGL_TUTORIAL_UNIFORM_BLOCK_H__
+#define __OPENGL_TUTORIAL_UNIFORM_BLOCK_H__
+
+#include "glad/glad.h"
+#include "glsl_types.h"
+#include "shader.h"
+#include "std140.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// The std140 type used to store each C++ value type.
+template <typename T>
+constexpr std140::Type std140TypeOf()
+{
+  if constexpr (std::is_same_v<T, float>) return std140::Type::Float;
+  else if constexpr (std::is_same_v<T, int>) return std140::Type::Int;
+  else if constexpr (std::is_same_v<T, unsigned int>) return std140::Type::UInt;
+  else if constexpr (std::is_same_v<T, bool>) return std140::Type::Bool;
+  else if constexpr (std::is_same_v<T, glsl::vec2>) return std140::Type::Vec2;
+  else if constexpr (std::is_same_v<T, glsl::vec3>) return std140::Type::Vec3;
+  else if constexpr (std::is_same_v<T, glsl::vec4>) return std140::Type::Vec4;
+  else if constexpr (std::is_same_v<T, glsl::ivec2>) return std140::Type::IVec2;
+  else if constexpr (std::is_same_v<T, glsl::ivec3>) return std140::Type::IVec3;
+  else if constexpr (std::is_same_v<T, glsl::ivec4>) return std140::Type::IVec4;
+  else if constexpr (std::is_same_v<T, glsl::mat3>) return std140::Type::Mat3;
+  else
+  {
+    static_assert(std::is_same_v<T, glsl::mat4>, "Not a uniform block type");
+    return std140::Type::Mat4;
+  }
+}
+
+// A member of a C++ struct which mirrors a std140 block, made with
+// BLOCK_FIELD(Struct, member). The members of the block are listed in order:
+//
+//   struct Globals { glsl::vec4 colour; float time; };
+//
+//   constexpr BlockField<Globals> globalsFields[] =
+//     { BLOCK_FIELD(Globals, colour), BLOCK_FIELD(Globals, time) };
+//
+//   static_assert(blockMatches(globalsFields), "Globals is not std140");
+//
+// StructBlock checks this when it is made, and the static_assert catches it
+// at compile time instead.
+template <typename Struct>
+struct BlockField
+{
+  const char* name;
+  std140::Type type;
+
+  // The array length, or 0 for a single value.
+  unsigned count;
+
+  std::size_t offset;
+  std::size_t size;
+};
+
+template <typename Struct, typename T>
+constexpr BlockField<Struct> blockField(const char* name, std::size_t offset)
+{
+  using Element = std::remove_extent_t<T>;
+  return {
+    name,
+    std140TypeOf<Element>(),
+    unsigned(std::extent_v<T>),
+    offset,
+    sizeof(T) };
+}
+
+#define BLOCK_FIELD(Struct, member) \
+  blockField<Struct, decltype(Struct::member)>(#member, offsetof(Struct, member))
+
+// The index of the first field which is not laid out in the struct as std140
+// lays it out in the block, or N if they all are.
+template <typename Struct, std::size_t N>
+constexpr std::size_t blockMismatch(const BlockField<Struct> (&fields)[N])
+{
+  unsigned end = 0;
+  for (std::size_t i = 0; i < N; i++)
+  {
+    const BlockField<Struct>& field = fields[i];
+    const unsigned offset = std140::memberOffset(end, field.type, field.count);
+    const unsigned size = std140::memberSize(field.type, field.count);
+    if (field.offset != offset || field.size != size) return i;
+    end = offset + size;
+  }
+
+  return N;
+}
+
+// The size std140 gives the block which the fields describe.
+template <typename Struct, std::size_t N>
+constexpr unsigned blockSize(const BlockField<Struct> (&fields)[N])
+{
+  unsigned end = 0;
+  for (const BlockField<Struct>& field : fields)
+  {
+    end = std140::memberOffset(end, field.type, field.count) +
+      std140::memberSize(field.type, field.count);
+  }
+
+  return std140::alignUp(end, 16);
+}
+
+// Whether the struct holds no more than the block, padded to a vec4 as the
+// block is, so that no member of the struct is missing from the fields.
+template <typename Struct, std::size_t N>
+constexpr bool blockCovers(const BlockField<Struct> (&fields)[N])
+{
+  return std140::alignUp(unsigned(sizeof(Struct)), 16) == blockSize(fields);
+}
+
+// Whether the fields are laid out in the struct exactly as std140 lays them
+// out in the block, and cover the whole struct, so that the struct can be
+// copied into the buffer as it is. That rules out bools (use int), mat3s
+// (whose columns std140 pads) and arrays of anything smaller than a vec4,
+// and vec3s need padding after them unless a scalar follows.
+template <typename Struct, std::size_t N>
+constexpr bool blockMatches(const BlockField<Struct> (&fields)[N])
+{
+  return blockMismatch(fields) == N && blockCovers(fields);
+}
+
+// The layout of the block which the fields describe.
+template <typename Struct, std::size_t N>
+std140::Layout blockLayout(const BlockField<Struct> (&fields)[N])
+{
+  std140::Layout layout;
+  for (const BlockField<Struct>& field : fields)
+  {
+    layout.add(field.name, field.type, field.count);
+  }
+
+  return layout;
+}
+
+// A uniform buffer shared by every program which declares the block.
+// Values are written into a CPU copy of the buffer with set(), which only
+// marks the bytes which actually changed. upload() then sends the changed
+// range with a single glBufferSubData, so per-frame globals cost one upload
+// per frame however many programs read them.
+class UniformBlock
+{
+public:
+  // A member located once with member(), to avoid name lookups per frame.
+  struct Member
+  {
+    unsigned offset;
+    std140::Type type;
+    unsigned count;
+  };
+
+  // Create the buffer and attach it to the given uniform buffer binding point.
+  UniformBlock(std::string name, std140::Layout layout, unsigned int binding);
+  ~UniformBlock();
+
+  UniformBlock(const UniformBlock&) = delete;
+  UniformBlock& operator=(const UniformBlock&) = delete;
+
+  // The GLSL declaration of the block, to be pasted into (or #included by)
+  // the shaders which use it.
+  std::string declaration() const { return layout.declaration(name); }
+
+  // Point the shader's block at this buffer, after checking that the program
+  // lays it out as we do: its size, and the type, offset, array length and
+  // strides of every member. Prints a message and throws if not. Blocks with
+  // an instance name are checked the same way.
+  void bind(const Shader& shader) const { bind(shader.ID); }
+  void bind(unsigned int program) const;
+
+  // Look up a member (prints a message and throws if there is none).
+  Member member(std::string_view memberName) const;
+
+  template <typename T>
+  void set(const Member& member, const T& value, unsigned index = 0);
+
+  template <typename T>
+  void set(std::string_view memberName, const T& value, unsigned index = 0);
+
+  // Send everything which changed since the last upload to the buffer.
+  void upload();
+
+  unsigned int buffer() const { return bufferID; }
+
+protected:
+  void write(unsigned offset, const void* value, unsigned size);
+
+  const std::string& blockName() const { return name; }
+
+  const std140::Layout& members() const { return layout; }
+
+private:
+  std::string name;
+  std140::Layout layout;
+  unsigned int binding;
+  unsigned int bufferID;
+
+  // The CPU copy of the buffer, and the range which has changed since the
+  // last upload (empty when dirtyBegin >= dirtyEnd).
+  std::vector<unsigned char> data;
+  unsigned dirtyBegin;
+  unsigned dirtyEnd;
+
+  // The type glGetActiveUniformsiv reports for each std140 type.
+  static GLenum glTypeOf(std140::Type type);
+
+  static int activeUniform(
+    unsigned int program,
+    unsigned int index,
+    GLenum property);
+};
+
+// A uniform block whose members are set together from a C++ struct, which
+// the fields given to the constructor describe (see BlockField). Only the
+// members which changed are sent by upload().
+template <typename Struct>
+class StructBlock : public UniformBlock
+{
+public:
+  // Prints a message and throws if the struct does not match the block
+  // (see blockMatches).
+  template <std::size_t N>
+  StructBlock(
+    std::string name,
+    const BlockField<Struct> (&fields)[N],
+    unsigned int binding);
+
+  using UniformBlock::set;
+
+  void set(const Struct& value);
+};
+
+template <typename Struct>
+template <std::size_t N>
+StructBlock<Struct>::StructBlock(
+  std::string name,
+  const BlockField<Struct> (&fields)[N],
+  unsigned int binding) :
+  UniformBlock(std::move(name), blockLayout(fields), binding)
+{
+  // set() copies the struct as it is, so anything else would upload garbage.
+  const std::size_t mismatch = blockMismatch(fields);
+  if (mismatch < N)
+  {
+    const BlockField<Struct>& field = fields[mismatch];
+    const std140::Member& member = members().members()[mismatch];
+    std::cout << "Uniform block " << blockName() << ": member " << field.name
+              << " is " << field.size << " bytes at offset " << field.offset
+              << " of the struct, but std140 puts "
+              << std140::memberSize(member.type, member.count)
+              << " bytes at offset " << member.offset << std::endl;
+    throw std::exception();
+  }
+
+  if (!blockCovers(fields))
+  {
+    std::cout << "Uniform block " << blockName() << ": the struct is "
+              << sizeof(Struct) << " bytes, but its fields only describe "
+              << members().size() << " bytes" << std::endl;
+    throw std::exception();
+  }
+}
+
+template <typename Struct>
+void StructBlock<Struct>::set(const Struct& value)
+{
+  // Member by member, so that the range to upload only covers the ones
+  // which changed.
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+  for (const std140::Member& member : members().members())
+  {
+    write(
+      member.offset,
+      bytes + member.offset,
+      std140::memberSize(member.type, member.count));
+  }
+}
+
+template <typename T>
+void UniformBlock::set(const Member& member, const T& value, unsigned index)
+{
+  constexpr std140::Type type = std140TypeOf<T>();
+  if (member.type != type || index >= std::max(member.count, 1u))
+  {
+    std::cout << "Uniform block " << name << ": cannot store a "
+              << std140::glslName(type) << " at element " << index
+              << " of a " << std140::glslName(member.type) << std::endl;
+    throw std::exception();
+  }
+
+  unsigned offset = member.offset + index * std140::arrayStride(type);
+
+  if constexpr (std::is_same_v<T, bool>)
+  {
+    int stored = value ? 1 : 0;
+    write(offset, &stored, sizeof(stored));
+  }
+  else if constexpr (std140::isMatrix(type))
+  {
+    // Each column is padded out to a vec4.
+    constexpr unsigned rows = std140::components(type);
+    for (unsigned column = 0; column < std140::columns(type); column++)
+    {
+      write(offset + 16 * column, &value.m[rows * column], 4 * rows);
+    }
+  }
+  else
+  {
+    write(offset, &value, sizeof(T));
+  }
+}
+
+template <typename T>
+void UniformBlock::set(
+  std::string_view memberName,
+  const T& value,
+  unsigned index)
+{
+  set(member(memberName), value, index);
+}
+
+#endif // __OPENGL_TUTORIAL_UNIFORM_BLOCK_H__
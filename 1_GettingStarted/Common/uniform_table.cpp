@@ -0,0 +1,148 @@
+#include "uniform_table.h"
+
+void UniformTable::build(unsigned int program)
+{
+  entries.clear();
+  slots.clear();
+  byLocation.clear();
+
+  int count = 0, maxLength = 0;
+  glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+  glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+  std::vector<UniformInfo> active;
+  std::size_t names = 0;
+
+  std::vector<char> nameBuffer(std::max(maxLength, 1));
+  for (int i = 0; i < count; i++)
+  {
+    int length = 0, size = 0;
+    GLenum type = 0;
+    glGetActiveUniform(
+      program, i, maxLength, &length, &size, &type, nameBuffer.data());
+
+    std::string name(nameBuffer.data(), length);
+    int location = glGetUniformLocation(program, name.c_str());
+
+    // Uniforms in named blocks have no location and are set through buffers.
+    if (location < 0) continue;
+
+    // Arrays are reported as "name[0]", and can also be set as "name" or by
+    // any of their elements, "name[i]".
+    names += name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0
+      ? std::size_t(size) + 1 : 1;
+
+    active.push_back({ name, hashName(name), location, type, size, {}, false });
+  }
+
+  // Keep the load factor below one half so that probe sequences stay short.
+  std::size_t capacity = 8;
+  while (capacity < names * 2) capacity *= 2;
+  slots.assign(capacity, -1);
+
+  for (UniformInfo& info : active)
+  {
+    const std::string& name = info.name;
+    if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+    {
+      std::string base = name.substr(0, name.size() - 3);
+      insert({ base, hashName(base), info.location, info.type, info.size,
+        {}, false });
+
+      // The locations of the other elements need not follow on from the
+      // first, so each is asked for. They keep the size of the array, so
+      // that they are never shadowed: an upload of the whole array through
+      // the first location changes them too.
+      for (int element = 1; element < info.size; element++)
+      {
+        std::string elementName = base + "[" + std::to_string(element) + "]";
+        int location = glGetUniformLocation(program, elementName.c_str());
+        if (location < 0) continue;
+
+        insert({ elementName, hashName(elementName), location, info.type,
+          info.size, {}, false });
+      }
+    }
+
+    insert(std::move(info));
+  }
+}
+
+int UniformTable::find(std::string_view name) const
+{
+  return find(name, hashName(name));
+}
+
+int UniformTable::find(std::string_view name, std::uint32_t hash) const
+{
+  int index = findIndex(name, hash);
+  return index < 0 ? -1 : entries[index].location;
+}
+
+const UniformInfo* UniformTable::info(std::string_view name) const
+{
+  return info(name, hashName(name));
+}
+
+const UniformInfo* UniformTable::info(
+  std::string_view name,
+  std::uint32_t hash) const
+{
+  int index = findIndex(name, hash);
+  return index < 0 ? nullptr : &entries[index];
+}
+
+bool UniformTable::update(
+  int location,
+  const void* value,
+  std::size_t size) const
+{
+  if (location < 0 || location >= int(byLocation.size())) return true;
+
+  int index = byLocation[location];
+  if (index < 0) return true;
+
+  const UniformInfo& info = entries[index];
+  if (info.size != 1 || size > sizeof(info.shadow)) return true;
+
+  if (info.shadowed && std::memcmp(info.shadow, value, size) == 0)
+  {
+    return false;
+  }
+
+  std::memcpy(info.shadow, value, size);
+  info.shadowed = true;
+  return true;
+}
+
+int UniformTable::findIndex(std::string_view name, std::uint32_t hash) const
+{
+  if (slots.empty()) return -1;
+
+  const std::size_t mask = slots.size() - 1;
+  for (std::size_t slot = hash & mask;; slot = (slot + 1) & mask)
+  {
+    int index = slots[slot];
+    if (index < 0) return -1;
+
+    const UniformInfo& info = entries[index];
+    if (info.hash == hash && info.name == name) return index;
+  }
+}
+
+void UniformTable::insert(UniformInfo info)
+{
+  const std::size_t mask = slots.size() - 1;
+  std::size_t slot = info.hash & mask;
+  while (slots[slot] >= 0) slot = (slot + 1) & mask;
+
+  slots[slot] = int(entries.size());
+
+  if (info.location >= int(byLocation.size()))
+  {
+    byLocation.resize(info.location + 1, -1);
+  }
+
+  byLocation[info.location] = int(entries.size());
+  entries.push_back(std::move(info));
+}
@@ -0,0 +1,78 @@
+#ifndef __OPENGL_TUTORIAL_UNIFORM_TABLE_H__
+#define __OPENGL_TUTORIAL_UNIFORM_TABLE_H__
+
+#include "glad/glad.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// FNV-1a hash of a uniform name. This is constexpr so that names which are
+// known at compile time can be hashed by the compiler.
+constexpr std::uint32_t hashName(std::string_view name)
+{
+  std::uint32_t hash = 2166136261u;
+  for (char c : name)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+// Everything we know about an active uniform after the program is linked.
+struct UniformInfo
+{
+  std::string name;
+  std::uint32_t hash;
+  int location;
+  GLenum type;
+  int size;
+
+  // The last value uploaded, so that setting the same value again can be
+  // skipped. Only single values (not arrays) of up to a mat4 are shadowed.
+  mutable unsigned char shadow[64];
+  mutable bool shadowed;
+};
+
+// Maps uniform names onto locations without asking the driver.
+// The table is filled once from the program's active uniforms and then looked
+// up with an open-addressing hash table, so a lookup never allocates.
+class UniformTable
+{
+public:
+  // Query the active uniforms of a linked program.
+  void build(unsigned int program);
+
+  // Find the location of a uniform (-1 if the program has no such uniform).
+  int find(std::string_view name) const;
+  int find(std::string_view name, std::uint32_t hash) const;
+
+  // Find everything known about a uniform (nullptr if there is no such
+  // uniform).
+  const UniformInfo* info(std::string_view name) const;
+  const UniformInfo* info(std::string_view name, std::uint32_t hash) const;
+
+  // Record a value about to be uploaded to a location. Returns false if it is
+  // the value which was uploaded last time, so the upload can be skipped.
+  bool update(int location, const void* value, std::size_t size) const;
+
+  const std::vector<UniformInfo>& uniforms() const { return entries; }
+
+private:
+  std::vector<UniformInfo> entries;
+
+  // Indices into entries by location (-1 for unused locations).
+  std::vector<int> byLocation;
+
+  // Indices into entries (-1 for an empty slot). The size is a power of two.
+  std::vector<int> slots;
+
+  int findIndex(std::string_view name, std::uint32_t hash) const;
+  void insert(UniformInfo info);
+};
+
+#endif // __OPENGL_TUTORIAL_UNIFORM_TABLE_H__
@@ -0,0 +1,186 @@
+#include "vertex_array.h"
+
+std::uint64_t VertexLayout::hash() const
+{
+  std::uint64_t hash = hashField(std::string_view(
+    reinterpret_cast<const char*>(&stride), sizeof(stride)),
+    FNV_OFFSET_BASIS_64);
+
+  for (const VertexAttribute& attribute : attributes)
+  {
+    const unsigned int fields[] = {
+      unsigned(attribute.components),
+      attribute.type,
+      attribute.normalized,
+      attribute.offset };
+
+    hash = hashField(attribute.name, hash);
+    hash = hashField(std::string_view(
+      reinterpret_cast<const char*>(fields), sizeof(fields)), hash);
+  }
+
+  return hash;
+}
+
+VertexArrayCache::~VertexArrayCache()
+{
+  for (const auto& array : arrays)
+  {
+    glDeleteVertexArrays(1, &array.second);
+  }
+}
+
+unsigned int VertexArrayCache::get(
+  const Shader& shader,
+  const VertexLayout& layout,
+  unsigned int vertexBuffer,
+  unsigned int elementBuffer)
+{
+  const std::uint64_t programLayout = shader.attributeLayout();
+  const std::uint64_t planKey = hashField(std::string_view(
+    reinterpret_cast<const char*>(&programLayout), sizeof(programLayout)),
+    layout.hash());
+
+  auto plan = plans.find(planKey);
+  if (plan == plans.end())
+  {
+    plan = plans.emplace(planKey, match(shader, layout)).first;
+  }
+
+  unsigned int& vao = arrays[{ planKey, vertexBuffer, elementBuffer }];
+  if (vao != 0)
+  {
+    glBindVertexArray(vao);
+    return vao;
+  }
+
+  glGenVertexArrays(1, &vao);
+  glBindVertexArray(vao);
+  glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+  if (elementBuffer != 0)
+  {
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBuffer);
+  }
+
+  for (const Binding& binding : plan->second.bindings)
+  {
+    const void* offset = reinterpret_cast<const void*>(
+      static_cast<std::uintptr_t>(binding.offset));
+
+    if (binding.integer)
+    {
+      glVertexAttribIPointer(binding.location, binding.components,
+        binding.type, plan->second.stride, offset);
+    }
+    else
+    {
+      glVertexAttribPointer(binding.location, binding.components,
+        binding.type, binding.normalized, plan->second.stride, offset);
+    }
+
+    glEnableVertexAttribArray(binding.location);
+  }
+
+  return vao;
+}
+
+void VertexArrayCache::invalidate(unsigned int buffer)
+{
+  // 0 stands for no element buffer in the keys, not for a buffer.
+  if (buffer == 0) return;
+
+  for (auto array = arrays.begin(); array != arrays.end();)
+  {
+    const unsigned int vertexBuffer = std::get<1>(array->first);
+    const unsigned int elementBuffer = std::get<2>(array->first);
+    if (vertexBuffer != buffer && elementBuffer != buffer)
+    {
+      ++array;
+      continue;
+    }
+
+    glDeleteVertexArrays(1, &array->second);
+    array = arrays.erase(array);
+  }
+}
+
+VertexArrayCache::Plan VertexArrayCache::match(
+  const Shader& shader,
+  const VertexLayout& layout)
+{
+  Plan plan;
+  plan.stride = layout.stride;
+
+  for (const AttributeInfo& attribute : shader.attributes())
+  {
+    const VertexAttribute* source = nullptr;
+    for (const VertexAttribute& candidate : layout.attributes)
+    {
+      if (candidate.name == attribute.name) source = &candidate;
+    }
+
+    if (source == nullptr)
+    {
+      std::cout << "Vertex layout has no data for attribute "
+                << attribute.name << std::endl;
+      throw std::exception();
+    }
+
+    // Missing components are filled in by the GL (with 0, 0, 0, 1), but
+    // extra ones would be silently dropped.
+    const int components = glslComponents(attribute.type);
+    if (components == 0 || attribute.size != 1
+     || source->components < 1 || source->components > components)
+    {
+      std::cout << "Vertex layout provides " << source->components
+                << " components for attribute " << attribute.name
+                << ", which the shader cannot read" << std::endl;
+      throw std::exception();
+    }
+
+    const bool integer = glslInteger(attribute.type);
+    if (integer && (source->type == GL_FLOAT || source->type == GL_HALF_FLOAT
+      || source->type == GL_DOUBLE))
+    {
+      std::cout << "Attribute " << attribute.name
+                << " is an integer in the shader but not in the vertex layout"
+                << std::endl;
+      throw std::exception();
+    }
+
+    plan.bindings.push_back({
+      unsigned(attribute.location),
+      source->components,
+      source->type,
+      source->normalized,
+      integer,
+      source->offset });
+  }
+
+  return plan;
+}
+
+int VertexArrayCache::glslComponents(GLenum type)
+{
+  switch (type)
+  {
+    case GL_FLOAT: case GL_INT: case GL_UNSIGNED_INT: return 1;
+    case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: return 2;
+    case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: return 3;
+    case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: return 4;
+    default: return 0;
+  }
+}
+
+bool VertexArrayCache::glslInteger(GLenum type)
+{
+  switch (type)
+  {
+    case GL_INT: case GL_INT_VEC2: case GL_INT_VEC3: case GL_INT_VEC4:
+    case GL_UNSIGNED_INT: case GL_UNSIGNED_INT_VEC2:
+    case GL_UNSIGNED_INT_VEC3: case GL_UNSIGNED_INT_VEC4:
+      return true;
+    default:
+      return false;
+  }
+}
@@ -0,0 +1,98 @@
+#ifndef __OPENGL_TUTORIAL_VERTEX_ARRAY_H__
+#define __OPENGL_TUTORIAL_VERTEX_ARRAY_H__
+
+#include "glad/glad.h"
+#include "hash.h"
+#include "shader.h"
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+// One attribute stored in a vertex buffer, matched to the shader by name.
+struct VertexAttribute
+{
+  std::string name;
+  int components;
+  GLenum type = GL_FLOAT;
+  bool normalized = false;
+  unsigned int offset = 0;
+};
+
+// How the vertices in a buffer are laid out.
+struct VertexLayout
+{
+  std::vector<VertexAttribute> attributes;
+  unsigned int stride;
+
+  std::uint64_t hash() const;
+};
+
+// Creates vertex array objects from the attributes a program reports.
+// Matching a buffer layout against a program's attributes is done once per
+// (program attribute layout, buffer layout) pair and reused for every buffer
+// with that layout, and the vertex array for each buffer is created once.
+// Programs with the same attribute layout share vertex arrays.
+//
+// Vertex arrays are found by the names of their buffers, which the GL may
+// give to a new buffer once the old one is deleted. Call invalidate() before
+// deleting a buffer the cache has seen (or keep the buffers alive for as
+// long as the cache), so that a new buffer does not get a vertex array which
+// still points at the old one.
+class VertexArrayCache
+{
+public:
+  VertexArrayCache() = default;
+  ~VertexArrayCache();
+
+  VertexArrayCache(const VertexArrayCache&) = delete;
+  VertexArrayCache& operator=(const VertexArrayCache&) = delete;
+
+  // Get the vertex array which feeds the buffers to the shader, and leave it
+  // bound. Prints a message and throws if the shader reads an attribute the
+  // layout does not provide, or one of an incompatible type.
+  unsigned int get(
+    const Shader& shader,
+    const VertexLayout& layout,
+    unsigned int vertexBuffer,
+    unsigned int elementBuffer = 0);
+
+  // Delete the vertex arrays which use the buffer, as a vertex or element
+  // buffer.
+  void invalidate(unsigned int buffer);
+
+private:
+  // A single glVertexAttrib(I)Pointer call.
+  struct Binding
+  {
+    unsigned int location;
+    int components;
+    GLenum type;
+    bool normalized;
+    bool integer;
+    unsigned int offset;
+  };
+
+  struct Plan
+  {
+    std::vector<Binding> bindings;
+    unsigned int stride;
+  };
+
+  std::unordered_map<std::uint64_t, Plan> plans;
+  std::map<std::tuple<std::uint64_t, unsigned int, unsigned int>, unsigned int>
+    arrays;
+
+  static Plan match(const Shader& shader, const VertexLayout& layout);
+
+  // The number of components of a GLSL attribute type, or 0 if it is not a
+  // scalar or vector type.
+  static int glslComponents(GLenum type);
+  static bool glslInteger(GLenum type);
+};
+
+#endif // __OPENGL_TUTORIAL_VERTEX_ARRAY_H__
@@ -1,6 +1,9 @@
 #include "glad/glad.h"
 #include "GLFW/glfw3.h"
+#include "gl_context.h"
 #include "shader.h"
+#include "shader_pipeline.h"
+#include "shader_watcher.h"
 #include <iostream>
 #include <cmath>
 
@@ -12,37 +15,31 @@ float vertices[] =
   -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 1.0f
 };
 
-void framesize_buffer_callback(GLFWwindow* window, int width, int height)
+void framesize_buffer_callback(int width, int height)
 {
   glViewport(0, 0, width, height);
 }
 
-void process_input(GLFWwindow* window)
+void process_input(GLContext& context)
 {
-  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+  if (context.keyPressed(GLFW_KEY_ESCAPE))
   {
-    glfwSetWindowShouldClose(window, true);
+    context.close();
   }
 }
 
-int main()
+int main(int argc, char** argv)
 {
-  glfwInit();
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-  GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
-  if (window == NULL)
+  // --headless (or LEARNOGL_BACKEND=headless) renders offscreen instead,
+  // with no display needed.
+  GLContext context;
+  const GLBackend backend = GLContext::requested(argc, argv);
+  if (!context.create(backend, 800, 600, "LearnOpenGL"))
   {
-    std::cout << "Failed to create GLFW window" << std::endl;
-    glfwTerminate();
     return -1;
   }
 
-  glfwMakeContextCurrent(window);
-
-  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  if (!context.loadGL())
   {
     std::cout << "Failed to initialise GLAD" << std::endl;
     return -2;
@@ -50,10 +47,20 @@ int main()
 
   glViewport(0, 0, 800, 600);
 
-  glfwSetFramebufferSizeCallback(window, framesize_buffer_callback);
+  context.onResize(framesize_buffer_callback);
+
+  // Create the shader program, reading the sources on a worker thread. One
+  // is enough for a single program.
+  ShaderPipeline pipeline(1);
+  pipeline.submit({ "upsideDown.vs", "fragmentShader.fs" });
+  Shader shader = std::move(pipeline.finish()[0]);
 
-  // Create the shader program.
-  Shader shader("upsideDown.vs", "fragmentShader.fs");
+  // The shader objects are not needed once the program has linked.
+  ShaderObjectCache::instance().trim();
+
+  // Rebuild the shader whenever its source files are edited.
+  ShaderWatcher watcher;
+  watcher.watch(shader, "upsideDown.vs", "fragmentShader.fs");
 
   // Create and bind a vertex array object.
   unsigned int VAO;
@@ -80,10 +87,13 @@ int main()
   // This line turns on wireframe drawing (useful for seeing the triangles).
 //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
-  while (!glfwWindowShouldClose(window))
+  while (!context.shouldClose())
   {
     // Input
-    process_input(window);
+    process_input(context);
+
+    // Pick up any edits to the shaders
+    watcher.update();
 
     // Render
     glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
@@ -95,11 +105,9 @@ int main()
     glDrawArrays(GL_TRIANGLES, 0, 3);
 
     // Event handling and swap buffers
-    glfwSwapBuffers(window);
-    glfwPollEvents();
+    context.swapBuffers();
+    context.pollEvents();
   }
 
-  glfwTerminate();
-
   return 0;
 }
@@ -1,6 +1,11 @@
 #include "glad/glad.h"
 #include "GLFW/glfw3.h"
+#include "gl_context.h"
 #include "shader.h"
+#include "shader_warmup.h"
+#include "embedded_shaders.h"
+#include "reflected_shaders.h"
+#include "vertex_array.h"
 #include <iostream>
 #include <cmath>
 
@@ -12,37 +17,31 @@ float vertices[] =
   -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 1.0f
 };
 
-void framesize_buffer_callback(GLFWwindow* window, int width, int height)
+void framesize_buffer_callback(int width, int height)
 {
   glViewport(0, 0, width, height);
 }
 
-void process_input(GLFWwindow* window)
+void process_input(GLContext& context)
 {
-  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+  if (context.keyPressed(GLFW_KEY_ESCAPE))
   {
-    glfwSetWindowShouldClose(window, true);
+    context.close();
   }
 }
 
-int main()
+int main(int argc, char** argv)
 {
-  glfwInit();
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-  GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
-  if (window == NULL)
+  // --headless (or LEARNOGL_BACKEND=headless) renders offscreen instead,
+  // with no display needed.
+  GLContext context;
+  const GLBackend backend = GLContext::requested(argc, argv);
+  if (!context.create(backend, 800, 600, "LearnOpenGL"))
   {
-    std::cout << "Failed to create GLFW window" << std::endl;
-    glfwTerminate();
     return -1;
   }
 
-  glfwMakeContextCurrent(window);
-
-  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  if (!context.loadGL())
   {
     std::cout << "Failed to initialise GLAD" << std::endl;
     return -2;
@@ -50,15 +49,16 @@ int main()
 
   glViewport(0, 0, 800, 600);
 
-  glfwSetFramebufferSizeCallback(window, framesize_buffer_callback);
+  context.onResize(framesize_buffer_callback);
 
-  // Create the shader program.
-  Shader shader("vertexShader.vs", "fragmentShader.fs");
+  // Create the shader program from the sources built into the executable.
+  Shader shader = Shader::fromSource(
+    shaders::vertexShader_vs,
+    shaders::fragmentShader_fs);
+  reflected::vertexShader_vs::Binder vertexUniforms(shader);
 
-  // Create and bind a vertex array object.
-  unsigned int VAO;
-  glGenVertexArrays(1, &VAO);
-  glBindVertexArray(VAO);
+  // The shader objects are not needed once the program has linked.
+  ShaderObjectCache::instance().trim();
 
   // Generate the vertex buffer
   unsigned int VBO;
@@ -68,39 +68,48 @@ int main()
   glBindBuffer(GL_ARRAY_BUFFER, VBO);
   glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
-  // Setup the vertex attribute pointers.
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float),
-    (void*)0);
-  glEnableVertexAttribArray(0);
-
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float),
-    (void*)(3*sizeof(float)));
-  glEnableVertexAttribArray(1);
+  // Describe the vertex buffer, and let the vertex array cache match it up
+  // with the attributes the shader declares.
+  VertexLayout layout =
+  {
+    {
+      { "aPos", 3, GL_FLOAT, false, 0 },
+      { "aColor", 3, GL_FLOAT, false, 3*sizeof(float) }
+    },
+    6*sizeof(float)
+  };
+
+  VertexArrayCache vertexArrays;
+  unsigned int VAO = vertexArrays.get(shader, layout, VBO);
+
+  // Draw with the shader once while loading, so that the first frame does not
+  // wait for the driver to finish compiling it.
+  ShaderWarmup warmup;
+  warmup.add(shader, layout, "embedded shaders");
+  warmup.run();
 
   // This line turns on wireframe drawing (useful for seeing the triangles).
 //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
-  while (!glfwWindowShouldClose(window))
+  while (!context.shouldClose())
   {
     // Input
-    process_input(window);
+    process_input(context);
 
     // Render
     glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
 
     shader.use();
-    shader.setFloat("hOffset", 0.5);
+    vertexUniforms.hOffset = 0.5f;
 
     glBindVertexArray(VAO);
     glDrawArrays(GL_TRIANGLES, 0, 3);
 
     // Event handling and swap buffers
-    glfwSwapBuffers(window);
-    glfwPollEvents();
+    context.swapBuffers();
+    context.pollEvents();
   }
 
-  glfwTerminate();
-
   return 0;
 }
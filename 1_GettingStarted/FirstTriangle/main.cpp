@@ -1,5 +1,9 @@
 #include "glad/glad.h"
 #include "GLFW/glfw3.h"
+#include "gl_context.h"
+#include "shader_object_cache.h"
+#include "shader_telemetry.h"
+#include <cstring>
 #include <iostream>
 
 float vertices[] =
@@ -34,35 +38,43 @@ const char* fragmentShaderSource =
 
 int create_shader_program(unsigned int* shaderProgram)
 {
-  // Compile the vertex shader
-  unsigned int vertexShader;
-  vertexShader = glCreateShader(GL_VERTEX_SHADER);
-  glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-  glCompileShader(vertexShader);
+  // Time each step for the shader build report.
+  ShaderBuildRecord build;
+  build.name = "<memory>";
+  build.sourceBytes =
+    std::strlen(vertexShaderSource) + std::strlen(fragmentShaderSource);
+  ShaderTimer timer;
+
+  // Compile the vertex shader (or reuse it if another program already has).
+  // The stages are released however the function returns.
+  CachedStage vertexStage(GL_VERTEX_SHADER, vertexShaderSource);
+  unsigned int vertexShader = vertexStage.id();
 
   // Confirm that the shader was compiled successfully
   int success;
   char infoLog[512];
   glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+  build.vertexCompileMs = timer.lap();
   if (!success)
   {
     glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
     std::cout << "Vertex shader compilation failed: " << infoLog << std::endl;
+    ShaderTelemetry::instance().recordFailure(build, infoLog);
     return success;
   }
 
-  // Compile the fragment shader
-  unsigned int fragmentShader;
-  fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-  glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-  glCompileShader(fragmentShader);
+  // Compile the fragment shader (or reuse it if another program already has)
+  CachedStage fragmentStage(GL_FRAGMENT_SHADER, fragmentShaderSource);
+  unsigned int fragmentShader = fragmentStage.id();
 
   // Confirm that the shader was compiled successfully
   glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+  build.fragmentCompileMs = timer.lap();
   if (!success)
   {
     glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
     std::cout << "Fragment shader compilation failed: " << infoLog << std::endl;
+    ShaderTelemetry::instance().recordFailure(build, infoLog);
     return success;
   }
 
@@ -74,50 +86,45 @@ int create_shader_program(unsigned int* shaderProgram)
 
   // Confirm that the program linked the two shaders correctly
   glGetProgramiv(*shaderProgram, GL_LINK_STATUS, &success);
+  build.linkMs = timer.lap();
   if (!success)
   {
     glGetProgramInfoLog(*shaderProgram, 512, NULL, infoLog);
     std::cout << "Shader program failed to link: " << infoLog << std::endl;
+    ShaderTelemetry::instance().recordFailure(build, infoLog);
     return success;
   }
 
-  glDeleteShader(vertexShader);
-  glDeleteShader(fragmentShader);
+  ShaderTelemetry::instance().record(build);
 
   return success;
 }
 
-void framesize_buffer_callback(GLFWwindow* window, int width, int height)
+void framesize_buffer_callback(int width, int height)
 {
   glViewport(0, 0, width, height);
 }
 
-void process_input(GLFWwindow* window)
+void process_input(GLContext& context)
 {
-  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+  if (context.keyPressed(GLFW_KEY_ESCAPE))
   {
-    glfwSetWindowShouldClose(window, true);
+    context.close();
   }
 }
 
-int main()
+int main(int argc, char** argv)
 {
-  glfwInit();
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-  GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
-  if (window == NULL)
+  // --headless (or LEARNOGL_BACKEND=headless) renders offscreen instead,
+  // with no display needed.
+  GLContext context;
+  const GLBackend backend = GLContext::requested(argc, argv);
+  if (!context.create(backend, 800, 600, "LearnOpenGL"))
   {
-    std::cout << "Failed to create GLFW window" << std::endl;
-    glfwTerminate();
     return -1;
   }
 
-  glfwMakeContextCurrent(window);
-
-  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  if (!context.loadGL())
   {
     std::cout << "Failed to initialise GLAD" << std::endl;
     return -2;
@@ -125,7 +132,7 @@ int main()
 
   glViewport(0, 0, 800, 600);
 
-  glfwSetFramebufferSizeCallback(window, framesize_buffer_callback);
+  context.onResize(framesize_buffer_callback);
 
   // Create the shader program.
   unsigned int shaderProgram;
@@ -134,6 +141,9 @@ int main()
     return -3;
   }
 
+  // The shader objects are not needed once the programs have linked.
+  ShaderObjectCache::instance().trim();
+
   // Create and bind a vertex array object.
   unsigned int VAO;
   glGenVertexArrays(1, &VAO);
@@ -162,10 +172,10 @@ int main()
   // This line turns on wireframe drawing (useful for seeing the triangles).
 //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
-  while (!glfwWindowShouldClose(window))
+  while (!context.shouldClose())
   {
     // Input
-    process_input(window);
+    process_input(context);
 
     // Render
     glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
@@ -176,11 +186,9 @@ int main()
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)0);
 
     // Event handling and swap buffers
-    glfwSwapBuffers(window);
-    glfwPollEvents();
+    context.swapBuffers();
+    context.pollEvents();
   }
 
-  glfwTerminate();
-
   return 0;
 }
@@ -0,0 +1,278 @@
+// Replays a trace of GL calls, written by a program built with
+// LEARNOGL_TRACE_GL_CALLS, on a headless context (Mesa's llvmpipe when there
+// is no GPU) as fast as it can, and reports how long each frame took.
+//
+//   glreplay <trace> [--width <w>] [--height <h>] [--check-errors]
+//            [--output <file.ppm>]
+//
+// Each frame is timed from its first call to the end of a glFinish after its
+// last, so the time includes the driver's work as well as the calls. The
+// program's default framebuffer is replaced by an offscreen one of the given
+// size (800x600 by default), which --output saves at the end.
+
+#include "glad/glad.h"
+#include "replay.h"
+#include "replay_calls.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  struct Options
+  {
+    std::string trace;
+    std::string output;
+    int width = 800;
+    int height = 600;
+    bool checkErrors = false;
+  };
+
+  bool parseOptions(int argc, char** argv, Options& options)
+  {
+    for (int i = 1; i < argc; i++)
+    {
+      const std::string arg = argv[i];
+      const bool hasValue = i + 1 < argc;
+      if (arg == "--width" && hasValue)
+      {
+        options.width = std::atoi(argv[++i]);
+      }
+      else if (arg == "--height" && hasValue)
+      {
+        options.height = std::atoi(argv[++i]);
+      }
+      else if (arg == "--output" && hasValue)
+      {
+        options.output = argv[++i];
+      }
+      else if (arg == "--check-errors")
+      {
+        options.checkErrors = true;
+      }
+      else if (options.trace.empty() && arg.compare(0, 2, "--") != 0)
+      {
+        options.trace = arg;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    return !options.trace.empty() && options.width > 0 && options.height > 0;
+  }
+
+  // Make a 3.3 core context current with no window or surface at all.
+  bool createHeadlessContext()
+  {
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+      eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    EGLDisplay display = getPlatformDisplay != nullptr
+      ? getPlatformDisplay(
+          EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr)
+      : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if (!eglInitialize(display, nullptr, nullptr) ||
+        !eglBindAPI(EGL_OPENGL_API))
+    {
+      return false;
+    }
+
+    const EGLint attributes[] =
+    {
+      EGL_CONTEXT_MAJOR_VERSION, 3,
+      EGL_CONTEXT_MINOR_VERSION, 3,
+      EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+      EGL_NONE
+    };
+
+    EGLContext context = eglCreateContext(
+      display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+    return context != EGL_NO_CONTEXT &&
+      eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+  }
+
+  // The framebuffer which stands in for the traced program's window.
+  GLuint createDefaultFramebuffer(int width, int height)
+  {
+    GLuint renderbuffers[2];
+    glGenRenderbuffers(2, renderbuffers);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    GLuint framebuffer;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(
+      GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+      GL_RENDERBUFFER, renderbuffers[1]);
+    glViewport(0, 0, width, height);
+    return framebuffer;
+  }
+
+  // Save the colour of the default framebuffer as a binary PPM.
+  bool savePPM(
+    const std::string& path, GLuint framebuffer, int width, int height)
+  {
+    std::vector<unsigned char> pixels(width * height * 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glReadPixels(
+      0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+    std::ofstream file(path, std::ios::binary);
+    file << "P6\n" << width << " " << height << "\n255\n";
+    for (int y = height - 1; y >= 0; y--)
+    {
+      for (int x = 0; x < width; x++)
+      {
+        file.write(
+          reinterpret_cast<const char*>(&pixels[(y * width + x) * 4]), 3);
+      }
+    }
+
+    return static_cast<bool>(file);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  Options options;
+  if (!parseOptions(argc, argv, options))
+  {
+    std::cout << "Usage: glreplay <trace> [--width <w>] [--height <h>] "
+                 "[--check-errors] [--output <file.ppm>]" << std::endl;
+    return -1;
+  }
+
+  if (!createHeadlessContext())
+  {
+    std::cout << "Failed to create a headless GL context" << std::endl;
+    return -2;
+  }
+
+  // Loaded up front rather than lazily, so that no lookups are timed with
+  // the first frames.
+  if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+  {
+    std::cout << "Failed to initialise GLAD" << std::endl;
+    return -3;
+  }
+
+  std::cout << "Replaying on " << glGetString(GL_RENDERER) << std::endl;
+
+  try
+  {
+    TraceReader in(options.trace);
+
+    // Calls in the trace give the index of the function in the glad which
+    // wrote it, which need not be the same as this one's.
+    const int replayFunctionCount = static_cast<int>(
+      sizeof(replayFunctionNames) / sizeof(replayFunctionNames[0]));
+    std::vector<int> functions;
+    for (const std::string& name : in.functionNames())
+    {
+      const auto it = std::find(replayFunctionNames,
+        replayFunctionNames + replayFunctionCount, name);
+      functions.push_back(it != replayFunctionNames + replayFunctionCount
+        ? static_cast<int>(it - replayFunctionNames) : -1);
+    }
+
+    const GLuint framebuffer =
+      createDefaultFramebuffer(options.width, options.height);
+    ReplayState state(framebuffer);
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> frameMs;
+    std::size_t calls = 0, frameCalls = 0;
+    Clock::time_point frameStart = Clock::now();
+
+    for (int call = in.nextCall(); call != -1; call = in.nextCall())
+    {
+      if (call == TraceReader::frameEnd)
+      {
+        glFinish();
+        const std::chrono::duration<double, std::milli> elapsed =
+          Clock::now() - frameStart;
+        frameMs.push_back(elapsed.count());
+        std::cout << "Frame " << frameMs.size() << ": " << std::fixed
+                  << std::setprecision(3) << elapsed.count() << " ms, "
+                  << frameCalls << " calls" << std::endl;
+
+        frameCalls = 0;
+        frameStart = Clock::now();
+        continue;
+      }
+
+      const int function = call < static_cast<int>(functions.size())
+        ? functions[call] : -1;
+      if (function == -1 || !replayCall(function, in, state))
+      {
+        std::cout << "Cannot replay call " << calls << " to "
+                  << (call < static_cast<int>(functions.size())
+                        ? in.functionNames()[call] : "an unknown function")
+                  << std::endl;
+        return -4;
+      }
+
+      if (options.checkErrors)
+      {
+        const GLenum error = glGetError();
+        if (error != GL_NO_ERROR)
+        {
+          std::cout << "Call " << calls << " to " << in.functionNames()[call]
+                    << " raised GL error 0x" << std::hex << error << std::dec
+                    << std::endl;
+        }
+      }
+
+      calls++;
+      frameCalls++;
+    }
+
+    glFinish();
+
+    if (!frameMs.empty())
+    {
+      std::vector<double> sorted = frameMs;
+      std::sort(sorted.begin(), sorted.end());
+      double total = 0.0;
+      for (double ms : frameMs) total += ms;
+
+      std::cout << frameMs.size() << " frames, " << calls << " calls"
+                << std::fixed << std::setprecision(3)
+                << ", mean " << total / frameMs.size() << " ms"
+                << ", median " << sorted[sorted.size() / 2] << " ms"
+                << ", min " << sorted.front() << " ms"
+                << ", max " << sorted.back() << " ms" << std::endl;
+    }
+
+    if (!options.output.empty() &&
+        !savePPM(options.output, framebuffer, options.width, options.height))
+    {
+      std::cout << "Failed to write " << options.output << std::endl;
+      return -5;
+    }
+  }
+  catch (const std::exception&)
+  {
+    return -4;
+  }
+
+  return 0;
+}
@@ -0,0 +1,409 @@
+#ifndef __OPENGL_TUTORIAL_REPLAY_H__
+#define __OPENGL_TUTORIAL_REPLAY_H__
+
+#include "glad/glad.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Reads a trace written by glad's call tracing (see gladTraceBegin in
+// glad.h). The whole trace is read into memory up front, so that replaying
+// it costs no file I/O, and the pointers handed to GL point straight into it.
+class TraceReader
+{
+public:
+  // The value nextCall() returns at the end of a frame.
+  static constexpr int frameEnd = 0xFFFF;
+
+  // Read the trace and its header. Prints a message and throws if it cannot
+  // be read or was written by a different build.
+  explicit TraceReader(const std::string& path);
+
+  // The names of the functions, by the index a call in the trace gives.
+  const std::vector<std::string>& functionNames() const { return names; }
+
+  // The index of the function of the next call, frameEnd, or -1 at the end
+  // of the trace.
+  int nextCall();
+
+  // The parameters of a call, in the order they were written.
+  template<typename T>
+  T read();
+
+  // A block of data, or nullptr if the pointer traced was NULL.
+  const void* payload();
+
+  // The size of the last payload().
+  std::size_t payloadSize() const { return lastPayloadSize; }
+
+  template<typename T>
+  const T* array() { return static_cast<const T*>(payload()); }
+
+  // The strings of a call which takes count of them.
+  const GLchar* const* strings(GLsizei count);
+
+  // A pointer which was an offset into a bound buffer.
+  const void* offset();
+  const void* const* offsets(GLsizei count);
+
+  // The pixels a texture upload read: data in the trace, or an offset into
+  // the pixel unpack buffer.
+  const void* pixels();
+
+  // Somewhere to put the pixels a read writes: scratch memory of the size
+  // the traced call wrote, or an offset into the pixel pack buffer.
+  void* pixelsOut();
+
+private:
+  // Prints a message and throws unless size more bytes are left.
+  void require(std::size_t size) const;
+
+  // The trace, 8 byte aligned like the payloads in it.
+  std::vector<std::uint64_t> data;
+  const unsigned char* bytes;
+  std::size_t size = 0;
+  std::size_t position = 0;
+  std::size_t lastPayloadSize = 0;
+
+  std::vector<std::string> names;
+  std::vector<const GLchar*> stringList;
+  std::vector<const void*> offsetList;
+  std::vector<unsigned char> readPixels;
+};
+
+// The kinds of object name which a trace maps from what the traced program
+// was given to what the replay is given. Shaders share the names of programs.
+enum class ReplayNames
+{
+  Buffer,
+  Texture,
+  VertexArray,
+  Framebuffer,
+  Renderbuffer,
+  Sampler,
+  Query,
+  Program,
+  Pipeline,
+  Count
+};
+
+// What the replay of a trace keeps track of: the objects, uniform locations
+// and syncs of the replay which stand for those of the traced program, and
+// the buffers mapped for the trace to write into.
+class ReplayState
+{
+public:
+  // Framebuffer 0 in the trace is replayed to this framebuffer.
+  explicit ReplayState(GLuint defaultFramebuffer);
+
+  // The replay's object for a traced name. Names which the trace did not
+  // create (0 above all) are used as they are.
+  GLuint name(ReplayNames kind, GLuint traced) const;
+
+  // The replay's objects for n traced names, valid until the next call.
+  const GLuint* names(ReplayNames kind, const GLuint* traced, GLsizei n);
+
+  // Somewhere for a glGen* call to put n names.
+  GLuint* scratchNames(GLsizei n);
+
+  // Map the n traced names to the replay's.
+  void bindNames(
+    ReplayNames kind, const GLuint* traced, const GLuint* actual, GLsizei n);
+
+  // The program which glUniform* calls set uniforms of: the one in use, or
+  // the active program of the bound pipeline.
+  GLuint uniformProgram() const;
+
+  void useProgram(GLuint traced) { currentProgram = traced; }
+  void bindPipeline(GLuint traced) { currentPipeline = traced; }
+  void activeShaderProgram(GLuint pipeline, GLuint program);
+
+  // Uniform locations and block indices, which each program maps itself.
+  // Ones the trace did not query are assumed to be the same in the replay.
+  GLint location(GLuint program, GLint traced) const;
+  void bindLocation(GLuint program, GLint traced, GLint actual);
+  GLuint blockIndex(GLuint program, GLuint traced) const;
+  void bindBlockIndex(GLuint program, GLuint traced, GLuint actual);
+
+  GLsync sync(GLsync traced) const;
+  void bindSync(GLsync traced, GLsync actual);
+
+  // The access to map a buffer with. Flushes are not replayed, since all of
+  // what was written is copied in at once when the buffer is unmapped.
+  GLbitfield mapAccess(GLbitfield access) const;
+
+  // A buffer was mapped, and is being unmapped with the data the traced
+  // program wrote into it (nullptr if it was not mapped for writing).
+  void mapped(GLenum target, void* pointer);
+  void unmap(GLenum target, const void* written, std::size_t size);
+
+private:
+  using Locations = std::map<std::pair<GLuint, GLint>, GLint>;
+  using BlockIndices = std::map<std::pair<GLuint, GLuint>, GLuint>;
+
+  GLuint defaultFramebuffer;
+  std::unordered_map<GLuint, GLuint>
+    objects[static_cast<int>(ReplayNames::Count)];
+  std::vector<GLuint> nameList;
+  std::vector<GLuint> generated;
+
+  GLuint currentProgram = 0;
+  GLuint currentPipeline = 0;
+  std::unordered_map<GLuint, GLuint> activePrograms;
+  Locations locations;
+  BlockIndices blockIndices;
+  std::unordered_map<GLsync, GLsync> syncs;
+  std::unordered_map<GLenum, void*> mappings;
+};
+
+TraceReader::TraceReader(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file)
+  {
+    std::cout << "Failed to open trace " << path << std::endl;
+    throw std::exception();
+  }
+
+  size = static_cast<std::size_t>(file.tellg());
+  data.resize((size + 7) / 8);
+  bytes = reinterpret_cast<const unsigned char*>(data.data());
+  file.seekg(0);
+  if (!file.read(reinterpret_cast<char*>(data.data()), size))
+  {
+    std::cout << "Failed to read trace " << path << std::endl;
+    throw std::exception();
+  }
+
+  // The magic number, then the version, pointer size and function count.
+  const bool isTrace = size >= 16 && std::memcmp(bytes, "GLTR", 4) == 0;
+  position = 4;
+  if (!isTrace || read<GLuint>() != 1)
+  {
+    std::cout << path << " is not a trace this replay can read" << std::endl;
+    throw std::exception();
+  }
+
+  const GLuint pointerSize = read<GLuint>();
+  const GLuint functionCount = read<GLuint>();
+  if (pointerSize != sizeof(void*))
+  {
+    std::cout << "The trace was written by a " << pointerSize * 8
+              << " bit program and can only be replayed by one" << std::endl;
+    throw std::exception();
+  }
+
+  for (GLuint i = 0; i < functionCount; i++)
+  {
+    names.emplace_back(array<char>());
+  }
+}
+
+int TraceReader::nextCall()
+{
+  if (position == size) return -1;
+  return read<std::uint16_t>();
+}
+
+template<typename T>
+T TraceReader::read()
+{
+  require(sizeof(T));
+  T value;
+  std::memcpy(&value, bytes + position, sizeof(T));
+  position += sizeof(T);
+  return value;
+}
+
+const void* TraceReader::payload()
+{
+  const GLuint length = read<GLuint>();
+  if (length == 0xFFFFFFFFu)
+  {
+    lastPayloadSize = 0;
+    return nullptr;
+  }
+
+  position += (8 - position % 8) % 8;
+  require(length);
+  const void* payload = bytes + position;
+  position += length;
+  lastPayloadSize = length;
+  return payload;
+}
+
+const GLchar* const* TraceReader::strings(GLsizei count)
+{
+  stringList.clear();
+  for (GLsizei i = 0; i < count; i++)
+  {
+    stringList.push_back(array<GLchar>());
+  }
+
+  return stringList.data();
+}
+
+const void* TraceReader::offset()
+{
+  return reinterpret_cast<const void*>(
+    static_cast<std::uintptr_t>(read<std::uint64_t>()));
+}
+
+const void* const* TraceReader::offsets(GLsizei count)
+{
+  offsetList.clear();
+  for (GLsizei i = 0; i < count; i++)
+  {
+    offsetList.push_back(offset());
+  }
+
+  return offsetList.data();
+}
+
+const void* TraceReader::pixels()
+{
+  const bool client = read<std::uint8_t>() != 0;
+  return client ? payload() : offset();
+}
+
+void* TraceReader::pixelsOut()
+{
+  const bool client = read<std::uint8_t>() != 0;
+  if (!client) return const_cast<void*>(offset());
+
+  readPixels.resize(static_cast<std::size_t>(read<std::uint64_t>()));
+  return readPixels.empty() ? nullptr : readPixels.data();
+}
+
+void TraceReader::require(std::size_t bytesNeeded) const
+{
+  if (size - position < bytesNeeded)
+  {
+    std::cout << "The trace ends in the middle of a call" << std::endl;
+    throw std::exception();
+  }
+}
+
+ReplayState::ReplayState(GLuint defaultFramebuffer) :
+  defaultFramebuffer(defaultFramebuffer)
+{
+}
+
+GLuint ReplayState::name(ReplayNames kind, GLuint traced) const
+{
+  if (kind == ReplayNames::Framebuffer && traced == 0)
+  {
+    return defaultFramebuffer;
+  }
+
+  const auto& map = objects[static_cast<int>(kind)];
+  const auto it = map.find(traced);
+  return it != map.end() ? it->second : traced;
+}
+
+const GLuint* ReplayState::names(
+  ReplayNames kind, const GLuint* traced, GLsizei n)
+{
+  if (traced == nullptr) return nullptr;
+
+  nameList.clear();
+  for (GLsizei i = 0; i < n; i++)
+  {
+    nameList.push_back(name(kind, traced[i]));
+  }
+
+  return nameList.data();
+}
+
+GLuint* ReplayState::scratchNames(GLsizei n)
+{
+  generated.assign(n > 0 ? n : 0, 0);
+  return generated.data();
+}
+
+void ReplayState::bindNames(
+  ReplayNames kind, const GLuint* traced, const GLuint* actual, GLsizei n)
+{
+  if (traced == nullptr) return;
+
+  auto& map = objects[static_cast<int>(kind)];
+  for (GLsizei i = 0; i < n; i++)
+  {
+    map[traced[i]] = actual[i];
+  }
+}
+
+GLuint ReplayState::uniformProgram() const
+{
+  if (currentProgram != 0 || currentPipeline == 0) return currentProgram;
+
+  const auto it = activePrograms.find(currentPipeline);
+  return it != activePrograms.end() ? it->second : 0;
+}
+
+void ReplayState::activeShaderProgram(GLuint pipeline, GLuint program)
+{
+  activePrograms[pipeline] = program;
+}
+
+GLint ReplayState::location(GLuint program, GLint traced) const
+{
+  const auto it = locations.find({program, traced});
+  return it != locations.end() ? it->second : traced;
+}
+
+void ReplayState::bindLocation(GLuint program, GLint traced, GLint actual)
+{
+  locations[{program, traced}] = actual;
+}
+
+GLuint ReplayState::blockIndex(GLuint program, GLuint traced) const
+{
+  const auto it = blockIndices.find({program, traced});
+  return it != blockIndices.end() ? it->second : traced;
+}
+
+void ReplayState::bindBlockIndex(GLuint program, GLuint traced, GLuint actual)
+{
+  blockIndices[{program, traced}] = actual;
+}
+
+GLsync ReplayState::sync(GLsync traced) const
+{
+  const auto it = syncs.find(traced);
+  return it != syncs.end() ? it->second : nullptr;
+}
+
+void ReplayState::bindSync(GLsync traced, GLsync actual)
+{
+  syncs[traced] = actual;
+}
+
+GLbitfield ReplayState::mapAccess(GLbitfield access) const
+{
+  return access & ~GL_MAP_FLUSH_EXPLICIT_BIT;
+}
+
+void ReplayState::mapped(GLenum target, void* pointer)
+{
+  mappings[target] = pointer;
+}
+
+void ReplayState::unmap(GLenum target, const void* written, std::size_t size)
+{
+  void* pointer = mappings[target];
+  if (pointer != nullptr && written != nullptr)
+  {
+    std::memcpy(pointer, written, size);
+  }
+
+  mappings.erase(target);
+}
+
+#endif // __OPENGL_TUTORIAL_REPLAY_H__
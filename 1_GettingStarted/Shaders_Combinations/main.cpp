@@ -0,0 +1,201 @@
+// Exercise 2.5's two triangles, with a fragment shader each, drawn through
+// ShaderCombinations. GL call counting, KHR_debug output and call tracing
+// are shown here too, when they are built in or asked for.
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+#include "gl_context.h"
+#include "gl_counters.h"
+#include "gl_debug.h"
+#include "gl_trace.h"
+#include "shader_combinations.h"
+#include "shader_object_cache.h"
+#include <cstring>
+#include <iostream>
+
+float vertices1[] =
+{
+   0.0f,  0.5f, 0.0f, // Upper-right corner  T1
+   0.0f, -0.5f, 0.0f, // Bottom-right corner T1
+  -1.0f, -0.5f, 0.0f, // Bottom-left corner  T1
+};
+
+float vertices2[] =
+{
+   1.0f,  0.5f, 0.0f, // Upper-right corner  T2
+   1.0f, -0.5f, 0.0f, // Bottom-right corner T2
+   0.0f, -0.5f, 0.0f, // Bottom-left corner  T2
+};
+
+const char* vertexShaderSource =
+  "#version 330 core\n"
+  "layout (location = 0) in vec3 aPos;\n"
+  "void main()\n"
+  "{\n"
+  "  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+  "}\0";
+
+const char* fragmentShaderOrange =
+  "#version 330 core\n"
+  "out vec4 FragColor;\n"
+  "void main()\n"
+  "{\n"
+  "  FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+  "}\0";
+
+const char* fragmentShaderYellow=
+  "#version 330 core\n"
+  "out vec4 FragColor;\n"
+  "void main()\n"
+  "{\n"
+  "  FragColor = vec4(1.0f, 1.0f, 0.0f, 1.0f);\n"
+  "}\0";
+
+void framesize_buffer_callback(int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+void process_input(GLContext& context)
+{
+  if (context.keyPressed(GLFW_KEY_ESCAPE))
+  {
+    context.close();
+  }
+}
+
+int main(int argc, char** argv)
+{
+  // LEARNOGL_GL_DEBUG asks for a debug context, whose messages are collected
+  // and printed between frames.
+  const bool debugOutput = GLDebugOutput::requested();
+
+  // --headless (or LEARNOGL_BACKEND=headless) renders offscreen instead,
+  // with no display needed.
+  GLContext context;
+  const GLBackend backend = GLContext::requested(argc, argv);
+  if (!context.create(backend, 800, 600, "LearnOpenGL", debugOutput))
+  {
+    return -1;
+  }
+
+  if (!context.loadGL())
+  {
+    std::cout << "Failed to initialise GLAD" << std::endl;
+    return -2;
+  }
+
+  if (debugOutput && !GLDebugOutput::instance().install())
+  {
+    std::cout << "The context has no debug output" << std::endl;
+  }
+
+  // With GL call tracing built in, LEARNOGL_GL_TRACE names a file to write
+  // the calls to for GLReplay.
+  GLTraceCapture trace;
+
+  glViewport(0, 0, 800, 600);
+
+  context.onResize(framesize_buffer_callback);
+
+  // The triangles share the vertex shader, and have a fragment shader each.
+  // Each stage is built once as a separable program, and the combinations
+  // are program pipelines. With --link-programs, or a driver without
+  // GL_ARB_separate_shader_objects, each combination is linked into a
+  // program of its own instead.
+  bool allowSeparable = true;
+  for (int i = 1; i < argc; i++)
+  {
+    if (std::strcmp(argv[i], "--link-programs") == 0) allowSeparable = false;
+  }
+
+  ShaderCombinations shaders(allowSeparable);
+  std::size_t vertexStage, orangeStage, yellowStage;
+  try
+  {
+    vertexStage = shaders.addVertexSource(vertexShaderSource);
+    orangeStage = shaders.addFragmentSource(fragmentShaderOrange);
+    yellowStage = shaders.addFragmentSource(fragmentShaderYellow);
+
+    // Make both combinations now, rather than in the first frame.
+    shaders.use(vertexStage, orangeStage);
+    shaders.use(vertexStage, yellowStage);
+  }
+  catch (std::exception&)
+  {
+    return -3;
+  }
+
+  // The shader objects are not needed once the programs have linked.
+  ShaderObjectCache::instance().trim();
+
+  // Create and bind a vertex array object for triangle 1.
+  unsigned int VAO1;
+  glGenVertexArrays(1, &VAO1);
+  glBindVertexArray(VAO1);
+
+  // Generate the vertex buffer
+  unsigned int VBO1;
+  glGenBuffers(1, &VBO1);
+
+  // Copy the vertex array into a buffer that OpenGL can use
+  glBindBuffer(GL_ARRAY_BUFFER, VBO1);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices1), vertices1, GL_STATIC_DRAW);
+
+  // Setup the vertex attribute pointers.
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+
+  // Run through the same procedure to create a VAO and VBO for the second
+  // triangle.
+  unsigned int VAO2;
+  glGenVertexArrays(1, &VAO2);
+  glBindVertexArray(VAO2);
+
+  // Generate the vertex buffer
+  unsigned int VBO2;
+  glGenBuffers(1, &VBO2);
+
+  // Copy the vertex array into a buffer that OpenGL can use
+  glBindBuffer(GL_ARRAY_BUFFER, VBO2);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices2), vertices2, GL_STATIC_DRAW);
+
+  // Setup the vertex attribute pointers.
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+
+  // This line turns on wireframe drawing (useful for seeing the triangles).
+//glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+
+  while (!context.shouldClose())
+  {
+    // Input
+    process_input(context);
+
+    // Render
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    shaders.use(vertexStage, orangeStage);
+    glBindVertexArray(VAO1);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    shaders.use(vertexStage, yellowStage);
+    glBindVertexArray(VAO2);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    // Event handling and swap buffers
+    context.swapBuffers();
+    trace.frame();
+    if (debugOutput)
+    {
+      GLDebugOutput::instance().endFrame();
+      printDebugMessages(std::cout);
+    }
+    context.pollEvents();
+  }
+
+  // With GL call counting built in, show what the last frame submitted.
+  printFrameCounters(std::cout);
+
+  return 0;
+}
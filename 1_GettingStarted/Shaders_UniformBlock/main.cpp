@@ -0,0 +1,221 @@
+// Shaders_Uniform's triangle, with its colour kept in a std140 uniform block
+// which a C++ struct mirrors, and uploaded once per frame by StructBlock.
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+#include "gl_context.h"
+#include "shader_object_cache.h"
+#include "shader_telemetry.h"
+#include "uniform_block.h"
+#include <cstring>
+#include <iostream>
+#include <cmath>
+
+float vertices[] =
+{
+   0.0f,  0.5f, 0.0f,
+   0.5f, -0.5f, 0.0f,
+  -0.5f, -0.5f, 0.0f
+};
+
+const char* vertexShaderSource =
+  "#version 330 core\n"
+  "layout (location = 0) in vec3 aPos;\n"
+  "void main()\n"
+  "{\n"
+  "  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+  "}\0";
+
+const char* fragmentShaderSource =
+  "#version 330 core\n"
+  "out vec4 FragColor;\n"
+  // Uniform variables can be accessed using OpenGL. These are kept in a
+  // buffer, which the Globals struct below mirrors.
+  "layout (std140) uniform Globals\n"
+  "{\n"
+  "  vec4 ourColor;\n"
+  "};\n"
+  "void main()\n"
+  "{\n"
+  "  FragColor = ourColor;\n"
+  "}\0";
+
+int create_shader_program(
+  unsigned int* shaderProgram,
+  const char* vertexShaderSource,
+  const char* fragmentShaderSource)
+{
+  // Time each step for the shader build report.
+  ShaderBuildRecord build;
+  build.name = "<memory>";
+  build.sourceBytes =
+    std::strlen(vertexShaderSource) + std::strlen(fragmentShaderSource);
+  ShaderTimer timer;
+
+  // Compile the vertex shader (or reuse it if another program already has).
+  // The stages are released however the function returns.
+  CachedStage vertexStage(GL_VERTEX_SHADER, vertexShaderSource);
+  unsigned int vertexShader = vertexStage.id();
+
+  // Confirm that the shader was compiled successfully
+  int success;
+  char infoLog[512];
+  glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+  build.vertexCompileMs = timer.lap();
+  if (!success)
+  {
+    glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
+    std::cout << "Vertex shader compilation failed: " << infoLog << std::endl;
+    ShaderTelemetry::instance().recordFailure(build, infoLog);
+    return success;
+  }
+
+  // Compile the fragment shader (or reuse it if another program already has)
+  CachedStage fragmentStage(GL_FRAGMENT_SHADER, fragmentShaderSource);
+  unsigned int fragmentShader = fragmentStage.id();
+
+  // Confirm that the shader was compiled successfully
+  glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+  build.fragmentCompileMs = timer.lap();
+  if (!success)
+  {
+    glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
+    std::cout << "Fragment shader compilation failed: " << infoLog << std::endl;
+    ShaderTelemetry::instance().recordFailure(build, infoLog);
+    return success;
+  }
+
+  // Create a shader program that combines the vertex and fragment shaders
+  *shaderProgram = glCreateProgram();
+  glAttachShader(*shaderProgram, vertexShader);
+  glAttachShader(*shaderProgram, fragmentShader);
+  glLinkProgram(*shaderProgram);
+
+  // Confirm that the program linked the two shaders correctly
+  glGetProgramiv(*shaderProgram, GL_LINK_STATUS, &success);
+  build.linkMs = timer.lap();
+  if (!success)
+  {
+    glGetProgramInfoLog(*shaderProgram, 512, NULL, infoLog);
+    std::cout << "Shader program failed to link: " << infoLog << std::endl;
+    ShaderTelemetry::instance().recordFailure(build, infoLog);
+    return success;
+  }
+
+  ShaderTelemetry::instance().record(build);
+
+  return success;
+}
+
+// The members of the Globals uniform block, which are uploaded together once
+// per frame.
+struct Globals
+{
+  glsl::vec4 ourColor;
+};
+
+constexpr BlockField<Globals> globalsFields[] =
+{
+  BLOCK_FIELD(Globals, ourColor)
+};
+
+static_assert(blockMatches(globalsFields), "Globals does not match std140");
+
+void framesize_buffer_callback(int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+void process_input(GLContext& context)
+{
+  if (context.keyPressed(GLFW_KEY_ESCAPE))
+  {
+    context.close();
+  }
+}
+
+int main(int argc, char** argv)
+{
+  // --headless (or LEARNOGL_BACKEND=headless) renders offscreen instead,
+  // with no display needed.
+  GLContext context;
+  const GLBackend backend = GLContext::requested(argc, argv);
+  if (!context.create(backend, 800, 600, "LearnOpenGL"))
+  {
+    return -1;
+  }
+
+  if (!context.loadGL())
+  {
+    std::cout << "Failed to initialise GLAD" << std::endl;
+    return -2;
+  }
+
+  glViewport(0, 0, 800, 600);
+
+  context.onResize(framesize_buffer_callback);
+
+  // Create the shader program.
+  unsigned int shaderProgram;
+  if (!create_shader_program(
+    &shaderProgram,
+    vertexShaderSource,
+    fragmentShaderSource))
+  {
+    return -3;
+  }
+
+  // The shader objects are not needed once the programs have linked.
+  ShaderObjectCache::instance().trim();
+
+  // Create the buffer holding the Globals block, and point the program at it.
+  StructBlock<Globals> globals("Globals", globalsFields, 0);
+  globals.bind(shaderProgram);
+
+  // Create and bind a vertex array object.
+  unsigned int VAO;
+  glGenVertexArrays(1, &VAO);
+  glBindVertexArray(VAO);
+
+  // Generate the vertex buffer
+  unsigned int VBO;
+  glGenBuffers(1, &VBO);
+
+  // Copy the vertex array into a buffer that OpenGL can use
+  glBindBuffer(GL_ARRAY_BUFFER, VBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+  // Setup the vertex attribute pointers.
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+
+  // This line turns on wireframe drawing (useful for seeing the triangles).
+//glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+
+  while (!context.shouldClose())
+  {
+    // Input
+    process_input(context);
+
+    // Render
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    float timeValue = context.time();
+    float greenValue = (std::sin(timeValue) / 2.0f) + 0.5f;
+    float redValue = (std::cos(timeValue) / 2.0f) + 0.5f;
+
+    globals.set(Globals{ { redValue, greenValue, 0.0f, 1.0f } });
+    globals.upload();
+
+    glUseProgram(shaderProgram);
+
+    glBindVertexArray(VAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    // Event handling and swap buffers
+    context.swapBuffers();
+    context.pollEvents();
+  }
+
+  return 0;
+}